@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Measures how many times per second widgets with an automatic text size can be resized,
+// with and without the cache of Text::findBestTextSize.
+
+#include <TGUI/TGUI.hpp>
+#include <TGUI/DefaultFont.hpp>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    double measureResizesPerSecond(std::vector<tgui::Widget::Ptr>& widgets, bool useCache)
+    {
+        const unsigned int rounds = 200;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int round = 0; round < rounds; ++round)
+        {
+            // Sizes like the ones produced by a layout animation or by dragging the window border
+            const float height = 20 + (round % 40) * 0.75f;
+            for (auto& widget : widgets)
+            {
+                if (!useCache)
+                    tgui::Text::clearBestTextSizeCache();
+
+                widget->setSize(150, height);
+            }
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        return (rounds * widgets.size()) / seconds;
+    }
+}
+
+int main()
+{
+    auto font = std::make_shared<sf::Font>();
+    if (!font->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+        return 1;
+
+    // All these widgets use an automatic text size by default or after setting the text size to 0
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (unsigned int i = 0; i < 20; ++i)
+    {
+        widgets.push_back(tgui::Button::create("Button"));
+        widgets.push_back(tgui::EditBox::create());
+        widgets.push_back(tgui::ProgressBar::create());
+
+        auto tabs = tgui::Tabs::create();
+        tabs->add("Tab");
+        tabs->setTextSize(0);
+        widgets.push_back(tabs);
+    }
+
+    for (auto& widget : widgets)
+        widget->setInheritedFont(font);
+
+    // Let the cache and the glyph metrics warm up before measuring
+    measureResizesPerSecond(widgets, true);
+
+    const double withoutCache = measureResizesPerSecond(widgets, false);
+    const double withCache = measureResizesPerSecond(widgets, true);
+
+    std::cout << "Resizes per second without cache: " << withoutCache << std::endl;
+    std::cout << "Resizes per second with cache:    " << withCache << std::endl;
+    std::cout << "Speedup: " << (withCache / withoutCache) << "x" << std::endl;
+    return 0;
+}
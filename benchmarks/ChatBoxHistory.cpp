@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Measures how long it takes to fill a chat box and to draw it, for a short and a long chat history.
+// Both should be independent of the amount of lines that are already in the chat box.
+
+#include <TGUI/TGUI.hpp>
+#include <TGUI/DefaultFont.hpp>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    void measure(tgui::Gui& gui, std::size_t lineCount)
+    {
+        auto chatBox = tgui::ChatBox::create();
+        chatBox->setSize(400, 300);
+        gui.add(chatBox);
+
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < lineCount; ++i)
+            chatBox->addLine("[" + tgui::to_string(i) + "] Some message that was written to the log");
+        auto end = std::chrono::steady_clock::now();
+
+        std::cout << lineCount << " lines: " << (std::chrono::duration<double, std::micro>(end - start).count() / lineCount)
+                  << " us per added line, ";
+
+        const unsigned int frames = 200;
+        start = std::chrono::steady_clock::now();
+        for (unsigned int frame = 0; frame < frames; ++frame)
+        {
+            chatBox->invalidate();
+            gui.draw();
+        }
+        end = std::chrono::steady_clock::now();
+
+        std::cout << (std::chrono::duration<double, std::milli>(end - start).count() / frames) << " ms per frame" << std::endl;
+        gui.remove(chatBox);
+    }
+}
+
+int main()
+{
+    auto font = std::make_shared<sf::Font>();
+    if (!font->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+        return 1;
+
+    sf::RenderTexture target;
+    if (!target.create(400, 300))
+        return 1;
+
+    tgui::Gui gui{target};
+    gui.setFont(font);
+
+    measure(gui, 20);
+    measure(gui, 200000);
+    return 0;
+}
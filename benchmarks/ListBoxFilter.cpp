@@ -0,0 +1,61 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// Measures how long a list box with many items needs to sort its items and to update its filter after every keystroke.
+
+#include <TGUI/TGUI.hpp>
+#include <chrono>
+#include <iostream>
+
+int main()
+{
+    const std::size_t itemCount = 500000;
+
+    auto listBox = tgui::ListBox::create();
+    for (std::size_t i = 0; i < itemCount; ++i)
+        listBox->addItem("asset/texture_" + tgui::to_string((i * 7919) % itemCount) + ".png");
+
+    auto start = std::chrono::steady_clock::now();
+    listBox->setSortComparator([](const sf::String& left, const sf::String& right){ return left < right; });
+    listBox->getShownItemCount();
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "Sorting " << itemCount << " items: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+
+    // Type the filter one character at a time, like a user would in a search box
+    const std::string filter = "texture_4242";
+    for (std::size_t length = 1; length <= filter.size(); ++length)
+    {
+        start = std::chrono::steady_clock::now();
+        listBox->setFilter(filter.substr(0, length));
+        const std::size_t shownItemCount = listBox->getShownItemCount();
+        end = std::chrono::steady_clock::now();
+
+        std::cout << "Filter \"" << filter.substr(0, length) << "\": " << shownItemCount << " items in "
+                  << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// Compares the memory needed to store the names or ids of a large list as sf::String and as the UTF-8 strings that
+// the widgets use internally, and measures how long a list box needs to find an item by its id.
+
+#include <TGUI/TGUI.hpp>
+#include <TGUI/CompactString.hpp>
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    std::size_t getMemoryUsage(const sf::String& string)
+    {
+        // Short strings are stored inside the object itself
+        const char* const data = reinterpret_cast<const char*>(string.getData());
+        const char* const objectBegin = reinterpret_cast<const char*>(&string);
+        if ((data >= objectBegin) && (data < objectBegin + sizeof(sf::String)))
+            return sizeof(sf::String);
+        else
+            return sizeof(sf::String) + (string.getSize() + 1) * sizeof(sf::Uint32);
+    }
+}
+
+int main()
+{
+    const std::size_t itemCount = 1000000;
+
+    std::vector<sf::String> strings;
+    std::vector<tgui::priv::CompactString> compactStrings;
+    strings.reserve(itemCount);
+    compactStrings.reserve(itemCount);
+    for (std::size_t i = 0; i < itemCount; ++i)
+    {
+        const sf::String name = "asset/texture_" + tgui::to_string(i) + ".png";
+        strings.push_back(name);
+        compactStrings.push_back(name);
+    }
+
+    std::size_t stringMemory = 0;
+    for (const auto& string : strings)
+        stringMemory += getMemoryUsage(string);
+
+    std::size_t compactMemory = 0;
+    for (const auto& string : compactStrings)
+        compactMemory += string.getMemoryUsage();
+
+    std::cout << "Memory of " << itemCount << " names as sf::String: " << (stringMemory / 1024) << " KB" << std::endl;
+    std::cout << "Memory of " << itemCount << " names as UTF-8:      " << (compactMemory / 1024) << " KB" << std::endl;
+    std::cout << "Saving: " << (100 - (100 * compactMemory / stringMemory)) << "%" << std::endl;
+
+    // The ids are compared without converting them back to sf::String
+    auto listBox = tgui::ListBox::create();
+    for (std::size_t i = 0; i < 100000; ++i)
+        listBox->addItem("Item", strings[i]);
+
+    const auto start = std::chrono::steady_clock::now();
+    listBox->setSelectedItemById(strings[99999]);
+    const auto end = std::chrono::steady_clock::now();
+    std::cout << "Selecting the last of 100000 items by id: "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+    return 0;
+}
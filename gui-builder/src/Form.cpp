@@ -162,10 +162,10 @@ std::vector<std::pair<tgui::Widget::Ptr, std::string>> Form::getWidgetsAndNames(
     std::vector<std::pair<tgui::Widget::Ptr, std::string>> pairs;
 
     const auto& widgets = m_widgetsContainer->getWidgets();
-    const auto& names = m_widgetsContainer->getWidgetNames();
+    const auto& names = m_widgetsContainer->getStoredWidgetNames();
 
     for (std::size_t i = 0; i < widgets.size(); ++i)
-        pairs.push_back(std::make_pair(widgets[i], names[i]));
+        pairs.push_back(std::make_pair(widgets[i], names[i].toString()));
 
     return pairs;
 }
@@ -245,16 +245,17 @@ void Form::load()
     m_widgetsContainer->loadWidgetsFromFile(getFilename());
 
     const auto& widgets = m_widgetsContainer->getWidgets();
-    const auto& widgetNames = m_widgetsContainer->getWidgetNames();
+    const auto& widgetNames = m_widgetsContainer->getStoredWidgetNames();
     for (std::size_t i = 0; i < widgets.size(); ++i)
     {
         const std::string id = tgui::to_string(widgets[i].get());
         m_widgets[id] = widgets[i];
 
         // Keep track of the highest id found in widgets with default names, to avoid creating new widgets with confusing names
-        if ((widgetNames[i].getSize() >= 7) && (widgetNames[i].substring(0, 6) == "Widget"))
+        const std::string& widgetName = widgetNames[i].getUtf8();
+        if ((widgetName.size() >= 7) && (widgetName.substr(0, 6) == "Widget"))
         {
-            const std::string potentialNumber = widgetNames[i].substring(6);
+            const std::string potentialNumber = widgetName.substr(6);
             if (std::all_of(potentialNumber.begin(), potentialNumber.end(), ::isdigit))
                 m_idCounter = std::max<unsigned int>(m_idCounter, tgui::stoi(potentialNumber));
         }
@@ -30,11 +30,30 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
 #include <SFML/OpenGL.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Clipping areas that are active while the gui is being drawn, stored as OpenGL scissor boxes
+        ///
+        /// The gui owns the stack, the Clipping objects push and pop areas onto it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TGUI_API ClippingStack
+        {
+            const sf::RenderTarget* target = nullptr;
+            std::vector<sf::IntRect> areas;
+            sf::IntRect appliedArea;
+            ClippingStack* previousStack = nullptr;
+            std::size_t culledCount = 0; // Amount of areas that were skipped by Clipping::cullArea
+        };
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Clipping
@@ -49,30 +68,10 @@ namespace tgui
         /// @param topLeft Position of the top left corner of the clipping area relative to the view
         /// @param size    Size of the clipping area relative to the view
         ///
+        /// The new clipping area is the intersection of the given area and the clipping area that was already active.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Clipping(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size)
-        {
-            const sf::Vector2i topLeftPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft));
-            const sf::Vector2i bottomRightPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft + size));
-
-            // Get the old clipping area
-            glGetIntegerv(GL_SCISSOR_BOX, m_scissor);
-
-            // Calculate the clipping area
-            const GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x), m_scissor[0]);
-            const GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y), static_cast<GLint>(target.getSize().y) - m_scissor[1]);
-            GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y), static_cast<GLint>(target.getSize().y) - m_scissor[1] - m_scissor[3]);
-            GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x), m_scissor[0] + m_scissor[2]);
-
-            // If the object outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
-
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-        }
+        Clipping(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -83,16 +82,84 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         // When the clipping object is destroyed, the old clipping is restored
-        ~Clipping()
-        {
-            glScissor(m_scissor[0], m_scissor[1], m_scissor[2], m_scissor[3]);
-        };
+        ~Clipping();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the clipping area is empty
+        ///
+        /// @return True when nothing that is drawn while this clipping object exists would be visible
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the clipping area that is currently active on the target is empty
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /// @return True when nothing that is drawn on the target right now would be visible
+        ///
+        /// This function can only return true while the gui is drawing to the target.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isCurrentAreaEmpty(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether an area lies completely outside the clipping area that is currently active on the target
+        ///
+        /// @param target  Target to which we are drawing
+        /// @param states  Current render states
+        /// @param topLeft Position of the top left corner of the area relative to the view
+        /// @param size    Size of the area relative to the view
+        ///
+        /// @return True when nothing that is drawn inside the area would be visible, in which case the area is counted as culled
+        ///
+        /// This function can only return true while the gui is drawing to the target.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool cullArea(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Makes the clipping objects use the given stack instead of querying the scissor box from OpenGL
+        ///
+        /// @param stack   Stack that will hold the clipping areas of the target
+        /// @param target  Target to which we are drawing
+        /// @param area    Scissor box that is currently set, in OpenGL coordinates
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void beginStack(priv::ClippingStack& stack, const sf::RenderTarget& target, const sf::IntRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stops using the stack that was passed to beginStack
+        ///
+        /// @param stack  Stack that was passed to beginStack
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endStack(priv::ClippingStack& stack);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        GLint m_scissor[4] = {};
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the OpenGL scissor box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyArea(const sf::IntRect& area);
+
+
+        const sf::RenderTarget& m_target;
+        priv::ClippingStack* m_stack = nullptr;
+        sf::IntRect m_oldArea;
+        bool m_empty = false;
+
+        static priv::ClippingStack* m_activeStack;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_COMPACT_STRING_HPP
+#define TGUI_COMPACT_STRING_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief String that is stored as UTF-8, for strings that are kept in large amounts but are rarely changed
+        ///
+        /// sf::String uses 4 bytes per character. Widget names, item ids and the lines of a chat box are mostly ASCII and are
+        /// only compared or handed back to the user, so they are stored as UTF-8 instead and only converted to sf::String when
+        /// they leave the widget. Short strings fit in the small buffer of std::string and don't allocate memory at all.
+        ///
+        /// The amount of characters is stored next to the bytes, so that the size can be compared without decoding the string.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API CompactString
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Default constructor, creates an empty string
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            CompactString() = default;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stores a copy of a string
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            CompactString(const sf::String& string);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the string as sf::String
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            sf::String toString() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the encoded bytes of the string
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const std::string& getUtf8() const
+            {
+                return m_utf8;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of characters in the string
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const
+            {
+                return m_length;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether the string is empty
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isEmpty() const
+            {
+                return m_length == 0;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Checks whether the string starts with the given characters
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool startsWith(const sf::String& prefix) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of bytes used by the object, including the memory that it allocated
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getMemoryUsage() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Compares the characters of the strings
+            ///
+            /// Comparing with an sf::String decodes the string on the fly, without creating a temporary sf::String.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            friend bool operator==(const CompactString& left, const CompactString& right)
+            {
+                return (left.m_length == right.m_length) && (left.m_utf8 == right.m_utf8);
+            }
+
+            friend TGUI_API bool operator==(const CompactString& left, const sf::String& right);
+
+            friend bool operator==(const sf::String& left, const CompactString& right)
+            {
+                return right == left;
+            }
+
+            friend bool operator!=(const CompactString& left, const CompactString& right)
+            {
+                return !(left == right);
+            }
+
+            friend bool operator!=(const CompactString& left, const sf::String& right)
+            {
+                return !(left == right);
+            }
+
+            friend bool operator!=(const sf::String& left, const CompactString& right)
+            {
+                return !(right == left);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            std::string m_utf8;
+            std::uint32_t m_length = 0;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMPACT_STRING_HPP
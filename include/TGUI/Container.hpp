@@ -28,13 +28,18 @@
 
 
 #include <list>
+#include <memory>
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/CompactString.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    class Gui;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -106,7 +111,17 @@ namespace tgui
         /// @return Vector of all widget names
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<sf::String>& getWidgetNames() const
+        std::vector<sf::String> getWidgetNames() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the names of all the widgets as they are stored, without converting and copying them
+        ///
+        /// @return Vector of all widget names, in the same order as the widgets returned by getWidgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<priv::CompactString>& getStoredWidgetNames() const
         {
             return m_widgetNames;
         }
@@ -307,6 +322,40 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are drawn to a texture that is reused until one of them changes
+        ///
+        /// @param enabled  Should the child widgets be cached?
+        ///
+        /// When the render cache is enabled, all child widgets are drawn to a render texture the first time the container
+        /// is drawn. As long as none of the widgets inside the container change, the texture is drawn instead of drawing each
+        /// widget separately. This is useful for containers with many widgets that rarely change.
+        ///
+        /// The cache is used by Group, Panel, ScrollablePanel, ChildWindow and the layouts.
+        /// It is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn to a texture that is reused until one of them changes
+        ///
+        /// @return Is the render cache enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the cached texture still matches the child widgets
+        ///
+        /// @return False when the render cache is disabled or when the child widgets have to be drawn again on the next draw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheValid() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places a widget before all other widgets
         ///
@@ -398,6 +447,12 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long it takes until the update function will change how the widget looks.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When this function is called then all the widgets receive the event (if there are widgets).
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -433,11 +488,18 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets that lie inside the area between (0,0) and contentSize, using the render cache when enabled.
+        // The child widgets are translated by contentOffset (e.g. the scroll position) before being drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCachedWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states, sf::Vector2f contentSize, sf::Vector2f contentOffset = {}) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::vector<Widget::Ptr> m_widgets;
-        std::vector<sf::String>  m_widgetNames;
+        std::vector<priv::CompactString> m_widgetNames;
 
         Widget::Ptr m_widgetBelowMouse;
 
@@ -447,6 +509,18 @@ namespace tgui
         // Did we enter handleEvent directly or because we got a MouseReleased event?
         bool m_handingMouseReleased = false;
 
+        // Texture to which the child widgets are drawn when the render cache is enabled
+        bool m_renderCacheEnabled = false;
+        mutable bool m_renderCacheValid = false;
+        mutable std::unique_ptr<sf::RenderTexture> m_renderCache;
+        mutable sf::Vector2f m_renderCacheOffset;
+        mutable sf::Vector2f m_renderCacheScale;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        friend class Widget; // Widget invalidates the render cache of its parents
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -516,6 +590,10 @@ namespace tgui
     protected:
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
+        friend class Widget; // Required to let widgets inform the gui that they changed
+
+        // The gui to which this container belongs
+        Gui* m_gui = nullptr;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DATA_SOURCE_HPP
+#define TGUI_DATA_SOURCE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Provides the rows of a list box or chat box on demand, instead of adding all of them to the widget up front
+    ///
+    /// The widget only asks for the rows that are (about to become) visible and only keeps a limited amount of them in memory,
+    /// so the data set can be much larger than what would fit inside the widget.
+    ///
+    /// Example:
+    /// @code
+    /// class DatabaseSource : public tgui::DataSource
+    /// {
+    /// public:
+    ///     std::size_t getRowCount() const override
+    ///     {
+    ///         return database.count();
+    ///     }
+    ///
+    ///     void fetchRows(std::size_t firstRow, std::size_t count, FetchCallback callback) override
+    ///     {
+    ///         std::thread([=](){ callback(database.query(firstRow, count)); }).detach();
+    ///     }
+    /// };
+    ///
+    /// listBox->setDataSource(std::make_shared<DatabaseSource>());
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DataSource
+    {
+    public:
+
+        typedef std::shared_ptr<DataSource> Ptr; ///< Shared data source pointer
+
+        /// Function that has to be called once with the rows that were requested, it may be called from any thread
+        using FetchCallback = std::function<void(std::vector<sf::String> rows)>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Virtual destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~DataSource() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of rows in the data set
+        ///
+        /// This function is called every time the widget is updated, so it has to return quickly. When the amount changes,
+        /// the widget will adjust its scrollbar by itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t getRowCount() const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading a range of rows
+        ///
+        /// @param firstRow  Index of the first row that is needed
+        /// @param count     Amount of rows that are needed, the range never ends past the row count
+        /// @param callback  Function to call with the rows once they are loaded
+        ///
+        /// The function should return immediately and pass the rows to the callback when they are available. The callback may
+        /// be called from another thread, the rows are only shown in the widget the next time it is updated on the gui thread.
+        /// When fewer rows are passed than were requested, the missing rows are shown empty.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void fetchRows(std::size_t firstRow, std::size_t count, FetchCallback callback) = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DATA_SOURCE_HPP
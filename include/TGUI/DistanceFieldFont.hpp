@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DISTANCE_FIELD_FONT_HPP
+#define TGUI_DISTANCE_FIELD_FONT_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Signed distance fields of the glyphs of a font, from which text of any size can be drawn
+        ///
+        /// sf::Font keeps a texture per character size. When many sizes are used (e.g. due to automatic text sizes or
+        /// animations) these textures use a lot of memory. When distance field rendering is enabled, the glyphs are only
+        /// rendered by sf::Font at a single base size. For every glyph the distance to its outline is stored in the alpha
+        /// channel of a single atlas per font, and a shader turns the distances back into sharp edges at any scale.
+        ///
+        /// The metrics of the glyphs at other sizes are scaled from the base size, so the measured size of a text can
+        /// differ slightly from the size that sf::Font would give (which rounds the advance of every glyph).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API DistanceFieldFont
+        {
+        public:
+
+            static const unsigned int BaseCharacterSize = 48; ///< Character size at which the glyphs are rendered
+            static const unsigned int Spread = 6; ///< Distance around the outline that is stored, in pixels at the base size
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Metrics and location in the atlas of a glyph, at the base character size
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            struct Glyph
+            {
+                float advance = 0;
+                sf::FloatRect bounds;    ///< Bounds of the glyph relative to the baseline, without the spread around it
+                sf::IntRect textureRect; ///< Part of the atlas that contains the glyph, including the spread around it
+            };
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Enables or disables drawing text from distance fields
+            ///
+            /// Enabling fails silently when shaders aren't supported, isEnabled will then keep returning false.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void setEnabled(bool enabled);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether text is drawn from distance fields
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static bool isEnabled();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the distance fields of a font, creating them when they didn't exist yet
+            ///
+            /// @param font  Font of the text, which has to remain alive while the fields are being used
+            /// @param bold  Whether the text is bold
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static DistanceFieldFont& get(const std::shared_ptr<sf::Font>& font, bool bold);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the shader that draws the glyphs, or nullptr when rendering with distance fields isn't enabled
+            ///
+            /// The shader has no parameters besides the texture, so texts drawn with it can be batched together.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static const sf::Shader* getShader();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor
+            ///
+            /// Use the get function instead of creating the fields yourself, so that they are shared.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            DistanceFieldFont(const sf::Font& font, bool bold);
+
+            // The object is referenced from the cache and should never be copied
+            DistanceFieldFont(const DistanceFieldFont&) = delete;
+            DistanceFieldFont& operator=(const DistanceFieldFont&) = delete;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the glyph of a character
+            ///
+            /// A place in the atlas is reserved for new glyphs, but the distance field is only stored in the texture when
+            /// getTexture is called. This function thus doesn't require an OpenGL context of its own.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const Glyph& getGlyph(sf::Uint32 codePoint);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the kerning offset between two characters at the base character size
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getKerning(sf::Uint32 first, sf::Uint32 second) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the atlas, after adding the fields of the glyphs that were requested since the last call
+            ///
+            /// The top left corner of the atlas contains a few opaque pixels, which are used to draw underlines.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const sf::Texture& getTexture();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of glyphs that have a place in the atlas
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getGlyphCount() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Calculates the fields of the glyphs that were requested and copies them to the texture
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void createPendingFields();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            static const unsigned int AtlasWidth = 1024;
+
+            const sf::Font& m_font;
+            bool m_bold;
+
+            std::unordered_map<sf::Uint32, Glyph> m_glyphs;
+            std::vector<sf::Uint32> m_pendingGlyphs;
+
+            sf::Texture m_texture;
+            bool m_textureCreated = false;
+
+            // Glyphs are placed in rows from left to right
+            unsigned int m_rowTop = 0;
+            unsigned int m_rowLeft = 0;
+            unsigned int m_rowHeight = 0;
+            unsigned int m_usedHeight = 0;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DISTANCE_FIELD_FONT_HPP
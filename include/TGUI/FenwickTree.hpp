@@ -0,0 +1,219 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FENWICK_TREE_HPP
+#define TGUI_FENWICK_TREE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Sequence of non-negative values of which the sums of the first elements can be found in logarithmic time
+        ///
+        /// Changing a value, appending a value, calculating the sum of the first values and finding the element that contains
+        /// a certain offset all take O(log n) time. This is used to find items by their position in long lists of items that
+        /// don't all have the same size, and to convert between positions and storage locations when items are removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename T>
+        class FenwickTree
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Default constructor, creates an empty sequence
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            FenwickTree() = default;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Creates the tree from a list of values in linear time
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit FenwickTree(const std::vector<T>& values) :
+                m_tree(values.size() + 1, T{})
+            {
+                for (std::size_t i = 1; i <= values.size(); ++i)
+                {
+                    m_tree[i] += values[i - 1];
+
+                    const std::size_t parent = i + lowestBit(i);
+                    if (parent <= values.size())
+                        m_tree[parent] += m_tree[i];
+                }
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of values
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const
+            {
+                return m_tree.empty() ? 0 : m_tree.size() - 1;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds a value behind the existing ones
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void pushBack(T value)
+            {
+                if (m_tree.empty())
+                    m_tree.push_back(T{});
+
+                // The new node contains the sum of the values in its range, which ends with the new value
+                const std::size_t i = m_tree.size();
+                m_tree.push_back(value + getPrefixSum(i - 1) - getPrefixSum(i - lowestBit(i)));
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes the values behind the given amount of values
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void truncate(std::size_t count)
+            {
+                // A node only depends on the values in front of it, so the remaining nodes stay valid
+                if (count < getSize())
+                    m_tree.resize(count + 1);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes all values
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear()
+            {
+                m_tree.clear();
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds a difference to the value at the given index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void add(std::size_t index, T difference)
+            {
+                for (std::size_t i = index + 1; i < m_tree.size(); i += lowestBit(i))
+                    m_tree[i] += difference;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the value at the given index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            T get(std::size_t index) const
+            {
+                return getPrefixSum(index + 1) - getPrefixSum(index);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the value at the given index
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void set(std::size_t index, T value)
+            {
+                add(index, value - get(index));
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of the first values
+            ///
+            /// @param count  Amount of values to add together
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            T getPrefixSum(std::size_t count) const
+            {
+                T sum{};
+                for (std::size_t i = count; i > 0; i -= lowestBit(i))
+                    sum += m_tree[i];
+
+                return sum;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of all values
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            T getTotal() const
+            {
+                return getPrefixSum(getSize());
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the largest amount of first values of which the sum doesn't exceed the given offset
+            ///
+            /// When the values are the heights of rows, this is the index of the row that contains the offset (or the amount of
+            /// rows when the offset lies below the last row).
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findPrefix(T offset) const
+            {
+                const std::size_t size = getSize();
+
+                std::size_t step = 1;
+                while (step * 2 <= size)
+                    step *= 2;
+
+                std::size_t count = 0;
+                for (; step > 0; step /= 2)
+                {
+                    if ((count + step <= size) && !(offset < m_tree[count + step]))
+                    {
+                        count += step;
+                        offset -= m_tree[count];
+                    }
+                }
+
+                return count;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            static std::size_t lowestBit(std::size_t i)
+            {
+                return i & (~i + 1);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            std::vector<T> m_tree; // Node i (starting from 1) contains the sum of the values in the range (i - lowestBit(i), i]
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FENWICK_TREE_HPP
@@ -29,6 +29,7 @@
 #include <TGUI/Config.hpp>
 #include <SFML/Graphics/Font.hpp>
 #include <string>
+#include <vector>
 #include <cstddef>
 #include <memory>
 
@@ -42,6 +43,26 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Range of unicode code points, both the first and last code point are part of the range
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphRange
+        {
+            sf::Uint32 first;
+            sf::Uint32 last;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the glyphs that were loaded by preloadGlyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphPreloadStatistics
+        {
+            std::size_t requestedGlyphCount = 0; ///< Amount of glyphs that were requested for all character sizes together, including the ones that were already loaded
+            std::size_t textureMemory = 0;       ///< Amount of bytes by which the glyph textures grew while loading the glyphs
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor which will set the font to nullptr
         ///
@@ -194,6 +215,25 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Renders glyphs in advance, so that the first frame that shows them doesn't have to wait for them
+        ///
+        /// @param ranges          Code points of the characters that have to be loaded
+        /// @param characterSizes  Text sizes for which the characters have to be loaded
+        /// @param bold            Load the bold version of the glyphs or the regular one?
+        ///
+        /// @return Amount of requested glyphs and the memory that the glyph textures of the font grew with
+        ///
+        /// The font keeps a texture per character size to which glyphs are added when they are first needed. Adding glyphs,
+        /// especially when the texture has to be resized, can be noticeable when many characters are shown at once (e.g. a
+        /// CJK text or a new text size). This function should be called from the thread that draws the gui, e.g. at startup
+        /// or while a loading screen is shown. To spread the work over several frames, call it with a few ranges at a time.
+        ///
+        /// The glyphs remain loaded as long as the font exists. Fonts that are loaded from the same file share their glyphs.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GlyphPreloadStatistics preloadGlyphs(const std::vector<GlyphRange>& ranges, const std::vector<unsigned int>& characterSizes, bool bold = false) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_FONT_CACHE_HPP
+#define TGUI_FONT_CACHE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <tuple>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Values that are stored per font, which are only returned as long as the font they were stored for still exists
+        ///
+        /// Keys usually contain the address of the font. Only a weak pointer to the font is kept, so the cache doesn't keep fonts
+        /// alive and a font that is created at the address of a destroyed one doesn't find the values of the old font. Values of
+        /// destroyed fonts are forgotten each time a new value is stored.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Key, typename Value = std::tuple<>>
+        class FontCache
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the value that was stored for the font, or nullptr when there is no such value
+            ///
+            /// A value that was stored for another font with the same key is removed.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Value* find(const Key& key, const std::shared_ptr<sf::Font>& font)
+            {
+                const auto it = m_entries.find(key);
+                if (it == m_entries.end())
+                    return nullptr;
+
+                // A font that was destroyed may have been replaced by a new font at the same address
+                if (it->second.font.lock() != font)
+                {
+                    m_entries.erase(it);
+                    return nullptr;
+                }
+
+                return &it->second.value;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the font that was stored with the key, or nullptr when there is none or when it no longer exists
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::shared_ptr<sf::Font> findFont(const Key& key) const
+            {
+                const auto it = m_entries.find(key);
+                if (it == m_entries.end())
+                    return nullptr;
+
+                return it->second.font.lock();
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stores a value for the font, replacing the value that was stored with the same key
+            ///
+            /// @return Reference to the stored value, which remains valid until the value is removed from the cache
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Value& insert(const Key& key, const std::shared_ptr<sf::Font>& font, Value value = {})
+            {
+                // Forget about the fonts that no longer exist
+                for (auto it = m_entries.begin(); it != m_entries.end();)
+                {
+                    if (it->second.font.expired())
+                        it = m_entries.erase(it);
+                    else
+                        ++it;
+                }
+
+                Entry& entry = m_entries[key];
+                entry.font = font;
+                entry.value = std::move(value);
+                return entry.value;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the value that was stored for the font, a default constructed value is stored when there is none
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Value& get(const Key& key, const std::shared_ptr<sf::Font>& font)
+            {
+                Value* value = find(key, font);
+                if (value)
+                    return *value;
+
+                return insert(key, font);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of stored values, including those of fonts that were destroyed since the last insert
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const
+            {
+                return m_entries.size();
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes all stored values
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear()
+            {
+                m_entries.clear();
+            }
+
+
+        private:
+
+            struct Entry
+            {
+                std::weak_ptr<sf::Font> font;
+                Value value;
+            };
+
+            std::map<Key, Entry> m_entries;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_CACHE_HPP
@@ -0,0 +1,259 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_GLYPH_METRICS_HPP
+#define TGUI_GLYPH_METRICS_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <unordered_map>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        class DistanceFieldFont;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Cache of the advances and kerning of the glyphs of a font, for a single character size and boldness
+        ///
+        /// Measuring text with sf::Font requires several map lookups inside SFML for every character. The metrics of the ASCII
+        /// characters are stored in flat tables, so that measuring ASCII text only sums array values. The tables are filled the
+        /// first time an entry is needed (the kerning per row), so creating the cache is cheap. Bit masks tell which entries are
+        /// loaded, getLineWidth checks them once for the whole text and then sums the tables without a branch per character.
+        /// Other characters are looked up in SFML the first time they are used and stored in a hash map.
+        ///
+        /// The tables are shared by everyone that measures text with the same font, size and style. A font should not be loaded
+        /// again while it is being used, as the cached metrics would no longer match.
+        ///
+        /// Text may be measured on multiple threads at once. Looking up a loaded ASCII entry doesn't lock anything, while all
+        /// calls into SFML and the lookups in the hash maps are protected by a single mutex (sf::Font isn't thread-safe).
+        /// Before starting threads, the glyphs should be preloaded on the calling thread and the metrics should be made
+        /// read-only. The threads then only read the tables and maps, without locking and without rasterizing glyphs.
+        ///
+        /// When text is drawn from distance fields, the metrics are scaled from the glyphs at the base size of the fields.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API GlyphMetrics
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the metrics for a font, creating them when they didn't exist yet
+            ///
+            /// @param font           Font of the text, which has to remain alive while the metrics are being used
+            /// @param characterSize  Size of the text
+            /// @param bold           Whether the text is bold
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static GlyphMetrics& get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor
+            ///
+            /// Use the get function instead of creating the metrics yourself, so that they are shared.
+            ///
+            /// @param distanceField  Fields of the font when the metrics should match text drawn from them, or nullptr
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            GlyphMetrics(const sf::Font& font, unsigned int characterSize, bool bold, DistanceFieldFont* distanceField = nullptr);
+
+            // The object is referenced from the cache and should never be copied
+            GlyphMetrics(const GlyphMetrics&) = delete;
+            GlyphMetrics& operator=(const GlyphMetrics&) = delete;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the horizontal distance to the next character
+            ///
+            /// A tab is as wide as 4 spaces.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getAdvance(sf::Uint32 codePoint)
+            {
+                if (codePoint < AsciiCount)
+                {
+                    if (!(m_asciiAdvancesLoaded[codePoint / 64].load(std::memory_order_acquire) & getAsciiBit(codePoint)))
+                        loadAsciiAdvance(codePoint);
+
+                    return m_asciiAdvances[codePoint];
+                }
+                else
+                    return getAdvanceSlow(codePoint);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the kerning offset between two characters
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getKerning(sf::Uint32 first, sf::Uint32 second)
+            {
+                if ((first < AsciiCount) && (second < AsciiCount))
+                {
+                    if (!(m_asciiKerningRowsLoaded[first / 64].load(std::memory_order_acquire) & getAsciiBit(first)))
+                        loadAsciiKerningRow(first);
+
+                    return m_asciiKerning[(first * AsciiCount) + second];
+                }
+                else
+                    return getKerningSlow(first, second);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the width of a piece of text that doesn't contain any newlines
+            ///
+            /// @param characters  Characters of the text
+            /// @param count       Amount of characters
+            /// @param prevChar    Character in front of the text, for the kerning of the first character
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getLineWidth(const sf::Uint32* characters, std::size_t count, sf::Uint32 prevChar = 0);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Loads the advances and kerning that are needed to measure or wrap a text
+            ///
+            /// @param characters  Characters of the text
+            /// @param count       Amount of characters
+            ///
+            /// This has to be called on the thread that owns the font, before other threads measure the text.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void preload(const sf::Uint32* characters, std::size_t count);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes whether the hash maps of all metrics may be read without locking
+            ///
+            /// @param readOnly  True while other threads are measuring preloaded text
+            ///
+            /// While the metrics are read-only, entries that weren't preloaded are still asked from the font (while holding the
+            /// lock), but they aren't stored.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void setReadOnly(bool readOnly);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the mutex that protects the caches and every call to sf::Font
+            ///
+            /// Code that uses a font outside of the metrics while text may be measured on other threads has to lock it. It may
+            /// not be held while calling functions of the metrics, as they lock it themselves.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::mutex& getFontMutex();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the line spacing of the font
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getLineSpacing() const
+            {
+                return m_lineSpacing;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the value that Text::calculateExtraVerticalSpace would return for this font
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getExtraVerticalSpace() const
+            {
+                return m_extraVerticalSpace;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the bit of an ASCII character within its half of a bit mask
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::uint64_t getAsciiBit(sf::Uint32 codePoint)
+            {
+                return std::uint64_t{1} << (codePoint % 64);
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Fills an entry of the advance table or a row of the kerning table
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void loadAsciiAdvance(sf::Uint32 codePoint);
+            void loadAsciiKerningRow(sf::Uint32 first);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Fills the advances and kerning rows of the characters in the bit mask that weren't loaded yet
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void loadAsciiTables(const std::uint64_t (&characters)[2]);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Asks the font or the distance fields for the metrics, the caller has to lock the font mutex
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float loadAdvance(sf::Uint32 codePoint);
+            float loadKerning(sf::Uint32 first, sf::Uint32 second);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Looks up the metrics of characters that aren't part of the ASCII tables
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            float getAdvanceSlow(sf::Uint32 codePoint);
+            float getKerningSlow(sf::Uint32 first, sf::Uint32 second);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            static const sf::Uint32 AsciiCount = 128;
+
+            const sf::Font& m_font;
+            unsigned int m_characterSize;
+            bool m_bold;
+            DistanceFieldFont* m_distanceField;
+            float m_distanceFieldScale = 1;
+
+            float m_lineSpacing = 0;
+            float m_extraVerticalSpace = 0;
+
+            // Bit masks of the loaded entries, a set bit is only read after the entry was written
+            std::atomic<std::uint64_t> m_asciiAdvancesLoaded[2];
+            std::atomic<std::uint64_t> m_asciiKerningRowsLoaded[2];
+
+            float m_asciiAdvances[AsciiCount];
+            std::vector<float> m_asciiKerning; // Table of [AsciiCount][AsciiCount], only allocated when needed as findBestTextSize creates metrics for many sizes
+
+            std::unordered_map<sf::Uint32, float> m_advances;
+            std::unordered_map<std::uint64_t, float> m_kerning;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_METRICS_HPP
@@ -28,6 +28,8 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -152,6 +154,101 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were needed during the last call to the draw function
+        ///
+        /// Geometry of consecutive widgets that use the same texture is merged into a single draw call.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times memory had to be allocated during the last call to the draw function
+        ///
+        /// The vertices of the widgets and the other data needed to draw them (like the clipping areas) are written into memory
+        /// that is reused every frame, so this only differs from 0 when the gui contains more geometry than in any frame before.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDrawAllocationCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of widgets that were skipped during the last call to the draw function
+        ///
+        /// Widgets that lie completely outside the visible area of their parent (e.g. the rows of a scrollable panel that were
+        /// scrolled out of view) are not drawn at all.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCulledWidgetCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether something changed in the gui since the last time it was drawn
+        ///
+        /// @return Has the gui changed since the last call to the draw function?
+        ///
+        /// Applications that only redraw the window when something changed can skip both gui.draw() and window.display()
+        /// when this function returns false and nothing else in the window changed.
+        ///
+        /// @code
+        /// gui.updateTime();
+        /// if (gui.needsRedraw())
+        /// {
+        ///     window.clear();
+        ///     gui.draw();
+        ///     window.display();
+        /// }
+        /// @endcode
+        ///
+        /// @see onInvalidated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the gui as changed, so that needsRedraw will return true until the gui is drawn again
+        ///
+        /// Widgets call this function themselves (via Widget::invalidate) whenever their looks change. You only need to call
+        /// it yourself when something changes that the gui can't know about, e.g. when drawing a custom widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it takes until the gui will change by itself
+        ///
+        /// @return Time until something like a blinking caret, an animation or a tool tip changes the gui.
+        ///         Zero is returned when the gui changes every frame, e.g. during an animation.
+        ///         When nothing is scheduled, the maximum value that sf::Time can hold is returned.
+        ///
+        /// Applications that only redraw when something changed can use this to sleep between frames instead of polling.
+        /// The time is only a hint: events still have to be handled and needsRedraw has to be checked after updating the time.
+        ///
+        /// @code
+        /// while (window.isOpen())
+        /// {
+        ///     sf::Event event;
+        ///     while (window.pollEvent(event))
+        ///         gui.handleEvent(event);
+        ///
+        ///     gui.updateTime();
+        ///     if (gui.needsRedraw())
+        ///     {
+        ///         window.clear();
+        ///         gui.draw();
+        ///         window.display();
+        ///     }
+        ///
+        ///     sf::sleep(std::min(gui.getTimeUntilNextUpdate(), sf::milliseconds(10)));
+        /// }
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -199,7 +296,7 @@ namespace tgui
         /// @return Vector of all widget names
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<sf::String>& getWidgetNames() const;
+        std::vector<sf::String> getWidgetNames() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,6 +505,20 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the internal clock with the time that passed since the previous call to this function
+        ///
+        /// The draw function also updates the time, but when you only want to call draw when needsRedraw returns true then you
+        /// have to call this function every frame to let animations, caret blinking and tool tips progress.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTime();
+
+
+        /// The gui changed while it had already been drawn. This signal is only emitted once until the gui is drawn again.
+        Signal onInvalidated = {"Invalidated"};
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -432,6 +543,15 @@ namespace tgui
 
         sf::View m_view;
 
+        // Did anything change since the gui was last drawn?
+        bool m_needsRedraw = true;
+
+        // Merges the geometry of the widgets to reduce the amount of draw calls
+        priv::RenderBatch m_renderBatch;
+
+        // Clipping areas that are active while drawing
+        priv::ClippingStack m_clippingStack;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,242 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_INDEXED_ITEM_LIST_HPP
+#define TGUI_INDEXED_ITEM_LIST_HPP
+
+
+#include <TGUI/CompactString.hpp>
+#include <TGUI/FenwickTree.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief List of items with a name, an id and a height, which can be found by name, id or position without looking at
+        ///        every item
+        ///
+        /// The heights of the items are stored in a Fenwick tree, so finding the item at a certain offset or the offset of an
+        /// item and changing the height of an item all take O(log n) time.
+        ///
+        /// Hash tables map the texts and ids to the items, and a trigram table finds the items that contain a piece of text.
+        /// These tables are only built when the list is searched for the first time, and are kept up-to-date afterwards.
+        ///
+        /// Removed items are only marked as removed so that the items behind them don't have to move. The list is compacted
+        /// once more than half of the stored items were removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API IndexedItemList
+        {
+        public:
+
+            struct Item
+            {
+                CompactString text;
+                CompactString id;
+            };
+
+            static constexpr std::size_t NotFound = std::numeric_limits<std::size_t>::max();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of items in the list
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const
+            {
+                return m_items.size() - m_removedCount;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the item at the given index, which has to be smaller than the amount of items
+            ///
+            /// This takes O(log n) time while the list contains removed items and constant time otherwise.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const Item& operator[](std::size_t index) const
+            {
+                return m_items[getSlot(index)];
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an item to the back of the list
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void add(const sf::String& text, const sf::String& id, unsigned int height);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes the item at the given index, which has to be smaller than the amount of items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void remove(std::size_t index);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the text of the item at the given index, which has to be smaller than the amount of items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setText(std::size_t index, const sf::String& text);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the height of the item at the given index, which has to be smaller than the amount of items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int getHeight(std::size_t index) const
+            {
+                return m_heights[getSlot(index)];
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the height of the item at the given index, which has to be smaller than the amount of items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setHeight(std::size_t index, unsigned int height);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the height of all items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setAllHeights(unsigned int height);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of the heights of the items in front of the item at the given index
+            ///
+            /// @param index  Index of the item, or the amount of items to get the total height
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int getTop(std::size_t index) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of the heights of all items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int getTotalHeight() const
+            {
+                return m_heightTree.getTotal();
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the index of the item that contains the given offset, or the amount of items when the offset lies
+            ///        below the last item
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findIndexAtOffset(unsigned int offset) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes all items behind the first ones
+            ///
+            /// @param count  Amount of items to keep
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void truncate(std::size_t count);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes all items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the index of the first item with the given text, or NotFound when there is no such item
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findText(const sf::String& text) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the index of the first item with the given id, or NotFound when there is no such item
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findId(const sf::String& id) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the indices of all items of which the text contains the given text, in ascending order
+            ///
+            /// The search is case-sensitive. When the text is at least 3 bytes long in utf-8, only the items that contain all
+            /// trigrams of the text are compared, otherwise all items are checked.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::vector<std::size_t> findTextsContaining(const sf::String& text) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            // Converts between the index of an item and the location where it is stored in m_items
+            std::size_t getSlot(std::size_t index) const;
+            std::size_t getIndex(std::size_t slot) const;
+
+            // Builds the hash tables if they don't exist yet
+            void buildLookupTables() const;
+
+            void insertIntoLookupTables(std::size_t slot) const;
+            void eraseFromLookupTables(std::size_t slot) const;
+            void clearLookupTables() const;
+
+            // Adds or removes the slot of an item to the lists of the trigrams that occur in its text
+            void insertIntoTrigramTable(std::size_t slot) const;
+            void eraseFromTrigramTable(std::size_t slot) const;
+
+            // Removes the items that were marked as removed from m_items
+            void compact();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            std::vector<Item> m_items;
+
+            // The heights are stored separately from the texts, so that looking at many of them doesn't require much memory.
+            // Removed items have a height of 0.
+            std::vector<unsigned int> m_heights;
+            FenwickTree<unsigned int> m_heightTree;
+
+            // When items were removed, these store which stored items no longer exist
+            std::vector<bool> m_removed;
+            FenwickTree<std::size_t> m_existingSlots;
+            std::size_t m_removedCount = 0;
+
+            // Map the hash of the utf-8 representation of the text and id to the slots of the items.
+            // Items with an empty id are not stored in the id table as most items don't have an id.
+            mutable std::unordered_multimap<std::size_t, std::size_t> m_textLookupTable;
+            mutable std::unordered_multimap<std::size_t, std::size_t> m_idLookupTable;
+            mutable bool m_lookupTablesBuilt = false;
+
+            // Maps each sequence of 3 bytes in the utf-8 texts to the sorted slots of the items that contain it. Removed items
+            // aren't erased from the lists, their text is empty so they never match. The table is cleared when compacting.
+            mutable std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> m_trigramTable;
+            mutable bool m_trigramTableBuilt = false;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INDEXED_ITEM_LIST_HPP
@@ -0,0 +1,206 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ITEM_VIEW_HPP
+#define TGUI_ITEM_VIEW_HPP
+
+
+#include <TGUI/IndexedItemList.hpp>
+#include <TGUI/SequenceTree.hpp>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Order in which the items of an IndexedItemList are shown, when they are sorted and/or filtered
+        ///
+        /// The view has to be informed about every change to the items. All items are kept in a sequence in the order in
+        /// which they are shown (including the ones that are filtered out), so adding, changing or removing a single item
+        /// only inserts or removes a single element and takes O(log n) time. Items that were added or whose text changed are
+        /// only sorted into the order when the rows are needed, so adding many items at once costs a single sort of the new
+        /// items and one pass over the existing ones. Finding the rows only takes integer operations.
+        /// When the items are neither sorted nor filtered, all functions simply forward to the item list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API ItemView
+        {
+        public:
+
+            using Comparator = std::function<bool(const sf::String& left, const sf::String& right)>;
+            using Predicate = std::function<bool(const sf::String& item)>;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether the items are sorted or filtered
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isActive() const
+            {
+                return m_comparator || m_filtered;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Sorts all items with the given comparator, or restores the original order when nullptr is passed
+            ///
+            /// The initial sort is executed on multiple threads, so the comparator has to be thread-safe.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setComparator(Comparator comparator, const IndexedItemList& items);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Only shows the items of which the text contains the given text, an empty text removes the filter
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setFilter(const sf::String& text, const IndexedItemList& items);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Only shows the items for which the predicate returns true, nullptr removes the filter
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setFilter(Predicate predicate, const IndexedItemList& items);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the text that was passed to setFilter, or an empty string when no text filter is active
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const sf::String& getFilterText() const
+            {
+                return m_filterText;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Functions that have to be called when the items change
+            ///
+            /// itemRemoved has to be called before the item is removed from the list, the others after the list was changed.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void itemAdded(const IndexedItemList& items);
+            void itemRemoved(std::size_t index, const IndexedItemList& items);
+            void itemTextChanged(std::size_t index, const IndexedItemList& items);
+            void itemHeightChanged(std::size_t index, unsigned int oldHeight, const IndexedItemList& items);
+            void allHeightsChanged(const IndexedItemList& items);
+            void itemsTruncated(std::size_t count, const IndexedItemList& items);
+            void itemsCleared();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of items that are shown
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getRowCount(const IndexedItemList& items) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the index of the item that is shown at the given row, which has to be smaller than the row count
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getItemIndex(std::size_t row, const IndexedItemList& items) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the row at which the item with the given index is shown, or IndexedItemList::NotFound when the
+            ///        item is filtered out
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findRow(std::size_t index, const IndexedItemList& items) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of the heights of the rows in front of the given row
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int getRowTop(std::size_t row, const IndexedItemList& items) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the row that contains the given offset, or the row count when the offset lies below the last row
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findRowAtOffset(unsigned int offset, const IndexedItemList& items) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of the heights of all rows
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int getTotalHeight(const IndexedItemList& items) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            bool matchesFilter(const IndexedItemList::Item& item) const;
+
+            // Recalculates which items are shown and the total height of these items
+            void applyFilter(const IndexedItemList& items);
+
+            // Removes the element of an item from both sequences, the item may no longer be in the list of pending items
+            void removeElement(std::size_t element);
+
+            // Returns which items pass the filter, by calling the filter for every item
+            std::vector<bool> findShownItems(const IndexedItemList& items) const;
+
+            // Returns which items passed the filter when it was last checked, including items that aren't sorted yet
+            std::vector<bool> getShownItems(std::size_t itemCount) const;
+
+            // Returns the indices of the items in the order in which they are shown, without the items that aren't sorted yet
+            std::vector<std::size_t> getOrder() const;
+
+            // Recreates the sequences from the given order of all items
+            void rebuild(const IndexedItemList& items, const std::vector<std::size_t>& order, const std::vector<bool>& shown) const;
+
+            // Sorts the items that were added or changed into the order
+            void update(const IndexedItemList& items) const;
+
+            void mergePendingItems(const IndexedItemList& items) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            Comparator m_comparator;
+            Predicate m_predicate;
+            sf::String m_filterText;
+            std::string m_filterUtf8;
+            bool m_filtered = false;
+
+            // Total height of the items that pass the filter, only used while filtering
+            unsigned int m_shownHeight = 0;
+
+            // Both sequences are only used while the view is active. The first one contains an element for every item, at the
+            // index of the item. Its payload is the element of the item in the second sequence, or None while the item still
+            // has to be sorted. The second sequence contains the items in the order in which they are shown, with the element
+            // of the item in the first sequence as payload and the height of the item as weight. In both sequences, the
+            // items that pass the filter are counted, so the counted elements of the second sequence are the rows.
+            mutable SequenceTree m_itemElements;
+            mutable SequenceTree m_order;
+
+            // Elements in m_itemElements of the items that were added or changed and that still have to be sorted
+            mutable std::vector<std::size_t> m_pendingItems;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ITEM_VIEW_HPP
@@ -28,6 +28,7 @@
 
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/Font.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,10 +65,33 @@ namespace tgui
         ///
         /// When the theme was loaded before and a renderer with the same name is encountered, the widgets that were using
         /// the old renderer will be reloaded with the new renderer.
+        ///
+        /// The theme can contain a Glyphs section, which lists glyphs that have to be rendered while loading the theme:
+        /// @code
+        /// Glyphs {
+        ///     Font      = "DejaVuSans.ttf";
+        ///     Ranges    = [U+0020-U+007E, U+3040-U+30FF];
+        ///     TextSizes = [13, 18];
+        ///     Bold      = false;
+        /// }
+        /// @endcode
+        /// The font is kept alive by the theme, widgets that load the same font file will share the rendered glyphs.
+        ///
+        /// @exception Exception when the Glyphs section contains invalid values
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void load(const std::string& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the glyphs that were rendered due to the Glyphs section of the theme
+        ///
+        /// @return Amount of requested glyphs and memory that was used by the glyph textures, or zeros if there was no Glyphs section
+        ///
+        /// @see Font::preloadGlyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Font::GlyphPreloadStatistics& getGlyphPreloadStatistics() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -152,6 +176,15 @@ namespace tgui
         static Theme* getDefault();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Renders the glyphs that are listed in the Glyphs section of the theme, if there is such a section
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -159,6 +192,8 @@ namespace tgui
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+        Font m_preloadedFont; ///< Font of the Glyphs section, kept alive to not lose the rendered glyphs
+        Font::GlyphPreloadStatistics m_glyphPreloadStatistics;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
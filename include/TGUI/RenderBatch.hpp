@@ -0,0 +1,494 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RENDER_BATCH_HPP
+#define TGUI_RENDER_BATCH_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Outline.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+    #include <SFML/Graphics/VertexBuffer.hpp>
+#endif
+#include <initializer_list>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Collects the geometry of the widgets and submits it to the render target in as few draw calls as possible
+        ///
+        /// Consecutive geometry that uses the same texture is merged into a single draw call. The draw order is never changed,
+        /// a new draw call is started whenever the texture changes, so the result is identical to drawing everything separately.
+        /// The only shader that can be batched is the one that draws text from distance fields, as it has no parameters.
+        ///
+        /// Anything that is drawn directly on the render target while a batch is active (or that changes the OpenGL state,
+        /// like the Clipping class does) has to call flushActive first so that the queued geometry ends up below it.
+        ///
+        /// The vertices are written into an arena that is reused every frame. It only grows when a frame needs more vertices
+        /// than any frame before, so drawing the same gui again doesn't allocate any memory.
+        ///
+        /// When vertex buffers are supported (SFML >= 2.5), every piece of geometry gets its own slot in a vertex buffer that is
+        /// kept between frames. A slot belongs to the owner that added the geometry (set with an OwnerScope, the containers use
+        /// their widgets) and to the position of the piece among the pieces of that owner. Owners that keep their vertices pass
+        /// a version (see createGeometryVersion) that they change whenever the vertices change. When the version, transform and
+        /// color of a piece are the same as in the previous frame, the piece is drawn from its slot without writing or uploading
+        /// its vertices again. Rectangles and borders are recognized by their size and thickness instead of by a version.
+        ///
+        /// Slots are placed in the order in which they are drawn and have unused vertices at their end filled with degenerate
+        /// triangles, so that neighbouring slots can still be drawn with a single draw call. A slot that grows is moved behind
+        /// the other slots, the slots are only placed in the drawing order again when this splits too many draw calls or when
+        /// the gaps left by moved and released slots take more room than the slots themselves.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API RenderBatch
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Default constructor
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            RenderBatch() = default;
+
+            // The batch cannot be copied as it may be registered as the active batch
+            RenderBatch(const RenderBatch&) = delete;
+            RenderBatch& operator=(const RenderBatch&) = delete;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Attributes all geometry that is added while the scope exists to an owner, which is usually a widget
+            ///
+            /// The previous owner is restored when the scope is destroyed. Geometry added without owner belongs to nullptr.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            class TGUI_API OwnerScope
+            {
+            public:
+
+                /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                /// @brief Constructor
+                ///
+                /// @param batch  Batch to which the owner is passed, nothing happens when this is a nullptr
+                /// @param owner  Object that adds the geometry, only used to recognize it again in the next frame
+                /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                OwnerScope(RenderBatch* batch, const void* owner);
+
+                /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                /// @brief Destructor that restores the previous owner
+                /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                ~OwnerScope();
+
+                OwnerScope(const OwnerScope&) = delete;
+                OwnerScope& operator=(const OwnerScope&) = delete;
+
+            private:
+                RenderBatch* m_batch;
+                const void* m_previousOwner = nullptr;
+                std::size_t m_previousPiece = 0;
+            };
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts collecting the geometry that is drawn to the given target
+            ///
+            /// The batch becomes the active batch until end is called.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void begin(sf::RenderTarget& target);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Draws the remaining geometry and restores the batch that was active before begin was called
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void end();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Draws all queued geometry to the target
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void flush();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds a triangle strip to the batch
+            ///
+            /// @param vertices     Vertices of the triangle strip, relative to the transform in the render states
+            /// @param vertexCount  Amount of vertices in the strip
+            /// @param states       Render states that would have been used to draw the vertices directly
+            /// @param version      Version of the vertices as returned by createGeometryVersion, or 0 when it is unknown
+            ///
+            /// Geometry that uses a custom shader or a non-default blend mode can't be merged and is drawn immediately.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addTriangleStrip(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, std::size_t version = 0);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds separate triangles to the batch
+            ///
+            /// @param vertices     Vertices of the triangles, relative to the transform in the render states
+            /// @param vertexCount  Amount of vertices, which should be a multiple of 3
+            /// @param states       Render states that would have been used to draw the vertices directly
+            /// @param version      Version of the vertices as returned by createGeometryVersion, or 0 when it is unknown
+            ///
+            /// Geometry that uses a custom shader or a non-default blend mode can't be merged and is drawn immediately.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addTriangles(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, std::size_t version = 0);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds separate triangles to the batch, all in the same color
+            ///
+            /// @param vertices     Vertices of the triangles, relative to the transform in the render states
+            /// @param vertexCount  Amount of vertices, which should be a multiple of 3
+            /// @param states       Render states that would have been used to draw the vertices directly
+            /// @param color        Color that replaces the color of the vertices
+            /// @param version      Version of the vertices as returned by createGeometryVersion, or 0 when it is unknown
+            ///
+            /// Geometry that uses a custom shader or a non-default blend mode can't be merged and is drawn immediately.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addTriangles(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, sf::Color color, std::size_t version = 0);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds a filled rectangle to the batch
+            ///
+            /// @param size    Size of the rectangle, its top-left corner is at the origin of the transform in the render states
+            /// @param color   Fill color of the rectangle
+            /// @param states  Render states that would have been used to draw the rectangle directly
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addRectangle(sf::Vector2f size, sf::Color color, const sf::RenderStates& states);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds the borders around a rectangle to the batch
+            ///
+            /// @param borders  Thickness of the borders, which lie inside the given size
+            /// @param size     Size of the rectangle, its top-left corner is at the origin of the transform in the render states
+            /// @param color    Color of the borders
+            /// @param states   Render states that would have been used to draw the borders directly
+            ///
+            /// When the borders don't fit inside the size, the entire rectangle is filled with the border color.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addBorders(const Borders& borders, sf::Vector2f size, sf::Color color, const sf::RenderStates& states);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an image that is split in 9 parts to the batch
+            ///
+            /// @param size         Size of the image on the screen, its top-left corner is at the origin of the transform
+            /// @param textureRect  Location of the image in the texture
+            /// @param middleRect   Part of the image that is stretched in both directions, relative to the image
+            /// @param color        Color that is multiplied with the texture
+            /// @param states       Render states that would have been used to draw the image directly
+            /// @param version      Version of the image as returned by createGeometryVersion, or 0 when it is unknown
+            ///
+            /// The corners keep their size, the sides between them are only stretched in one direction.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addNineSlice(sf::Vector2f size, const sf::FloatRect& textureRect, const sf::FloatRect& middleRect, sf::Color color,
+                              const sf::RenderStates& states, std::size_t version = 0);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Temporarily stops collecting geometry
+            ///
+            /// @param paused  Should getActive and flushActive ignore this batch?
+            ///
+            /// While paused, everything is drawn directly on the target. The queued geometry is flushed when pausing.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setPaused(bool paused);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of draw calls that were made between the last calls to begin and end
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getDrawCallCount() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns how many times memory was allocated while drawing, between the last calls to begin and end
+            ///
+            /// This counts the growth of the vertex arena and of the other containers of the batch, of the vertex buffer, and the
+            /// allocations reported with countAllocation (including those of nested batches). It is zero when the frame didn't
+            /// contain more geometry than an earlier frame drawn with this batch.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getAllocationCount() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns how many vertices had to be sent to the GPU between the last calls to begin and end
+            ///
+            /// When vertex buffers are used, only the pieces that were written again are counted, which is zero when the frame was
+            /// identical to the previous one. Pieces that didn't fit in the vertex buffer are counted twice, as they are drawn
+            /// from memory before being copied into the enlarged buffer. Without vertex buffers all vertices drawn are counted.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getUploadedVertexCount() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of vertices for which room was reserved in the vertex buffer
+            ///
+            /// This is 0 when vertex buffers aren't used.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getVertexBufferSize() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the batch that is currently collecting geometry for the given target
+            ///
+            /// @return Active batch or nullptr when nothing is being batched for this target
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static RenderBatch* getActive(const sf::RenderTarget& target);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Flushes the active batch of the target, if there is one
+            ///
+            /// This has to be called before drawing directly on the target or before changing the clipping area.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void flushActive(const sf::RenderTarget& target);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds a memory allocation made while drawing to the allocation count of the active batch
+            ///
+            /// Code on the draw path that has to grow a container (like the clipping stack) calls this, so that
+            /// Gui::getDrawAllocationCount includes it. Nothing happens when no batch is active.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void countAllocation();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns a new version number for vertices that are kept between frames
+            ///
+            /// Objects that keep their vertices (like Sprite) pass the version when adding them to a batch and take a new version
+            /// each time their vertices change. The numbers are unique within the process, so copies of an object can share them.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static std::size_t createGeometryVersion();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns whether geometry with these render states can be merged with the other geometry in the batch
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool prepareStates(const sf::RenderStates& states);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns a pointer to the end of the used vertices, with room for at least the given amount of extra vertices.
+            // The caller has to increase m_vertexCount with the amount of vertices that it writes.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            sf::Vertex* reserveVertices(std::size_t count);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Adds separate triangles, they keep their own color when no color is passed
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addTriangleList(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, const sf::Color* color, std::size_t version);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Writes the two triangles of a rectangle and returns the location behind them
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static sf::Vertex* writeQuad(sf::Vertex* out, const sf::Transform& transform, const sf::FloatRect& rect, sf::Color color,
+                                         const sf::FloatRect& textureRect = {});
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Identifies what the vertices in a slot were created from
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            struct Signature
+            {
+                Signature(std::size_t version, const sf::Transform& transform, sf::Color color, std::initializer_list<float> params = {});
+
+                bool operator==(const Signature& other) const;
+
+                std::size_t version; // 0 when the vertices are unknown, such a signature never equals another one
+                float transform[16];
+                sf::Color color;
+                float params[6];
+            };
+
+            struct SlotKey
+            {
+                const void* owner;
+                std::size_t piece;
+
+                bool operator==(const SlotKey& other) const
+                {
+                    return (owner == other.owner) && (piece == other.piece);
+                }
+            };
+
+            struct SlotKeyHash
+            {
+                std::size_t operator()(const SlotKey& key) const
+                {
+                    return std::hash<const void*>()(key.owner) * 31 + key.piece;
+                }
+            };
+
+            // Part of the vertex buffer that belongs to one piece of geometry
+            struct Slot
+            {
+                Signature signature{0, {}, {}};
+                std::size_t offset = 0;
+                std::size_t capacity = 0;
+                std::size_t count = 0;  // Vertices behind this amount are degenerate
+                std::size_t frame = 0;  // Last frame in which the slot was used
+                bool placed = false;
+            };
+
+            // Geometry that was added in a single call
+            struct Piece
+            {
+                Slot* slot;
+                std::size_t first;  // Location of the vertices in the arena, only when the piece was written there
+                std::size_t count;
+                bool written;       // Were the vertices written in the arena in this frame?
+                bool inBuffer;      // Can the vertices be drawn from the slot in the vertex buffer?
+            };
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the slot for the next piece of the current owner, or nullptr when vertex buffers aren't used
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Slot* nextSlot();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Draws the piece from its slot when the slot still contains the same geometry, so that it doesn't have to be written
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool reuseSlot(Slot* slot, const Signature& signature);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Remembers that the vertices behind index first, which were just written to the arena, belong to the slot
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addPiece(Slot* slot, std::size_t first, const Signature& signature);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Adds a piece to the list of pieces of this frame, counting the allocation when the list has to grow
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void pushPiece(const Piece& piece);
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Uploads the pieces that weren't drawn yet and that were written in this frame, as far as they fit in the buffer
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void uploadPieces(std::size_t firstPiece);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Gives a slot a place behind all other slots and uploads the piece into it, returns false when the buffer is full
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool uploadPiece(Piece& piece);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Draws the pieces that weren't drawn yet, neighbouring slots and neighbouring vertices in the arena are drawn together
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void drawPieces(const sf::RenderStates& states);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Enlarges the vertex buffer after pieces didn't fit in it, and uploads those pieces
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void growVertexBuffer();
+#endif
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Marks a slot as no longer placed, the part of the vertex buffer that it used becomes a gap
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void releaseSlot(Slot& slot);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Forgets where the slots are, so that all geometry is written again and placed in the drawing order
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void resetSlots();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            sf::RenderTarget* m_target = nullptr;
+            RenderBatch* m_previousBatch = nullptr;
+
+            // Arena in which the vertices are stored. Its size is its capacity, only the first m_vertexCount vertices are used.
+            std::vector<sf::Vertex> m_vertices;
+            std::size_t m_vertexCount = 0;
+            std::size_t m_flushedVertexCount = 0; // Vertices before this index were already drawn
+
+            const void* m_owner = nullptr;
+            std::size_t m_piece = 0; // Amount of pieces that the current owner already added in this frame
+
+            bool m_useVertexBuffer = false;
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            sf::VertexBuffer m_vertexBuffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Dynamic};
+#endif
+            std::vector<sf::Vertex> m_degenerateVertices; // Uploaded behind the vertices of a slot that shrunk
+            std::size_t m_usedBufferSize = 0; // Vertices behind this index don't belong to any slot
+            std::size_t m_placedBufferSize = 0; // Sum of the capacities of the placed slots, the rest of the used size are gaps
+            std::size_t m_overflowSize = 0; // Size of the slots that didn't fit in the vertex buffer during this frame
+            std::unordered_map<SlotKey, Slot, SlotKeyHash> m_slots;
+            std::size_t m_usedSlotCount = 0; // Amount of slots that were used in this frame
+            std::vector<Piece> m_pieces;
+            std::size_t m_flushedPieceCount = 0;
+            std::size_t m_frame = 0;
+            std::size_t m_scatteredDrawCalls = 0; // Draw calls that were needed because slots weren't next to each other
+
+            const sf::Texture* m_texture = nullptr;
+            const sf::Shader* m_shader = nullptr;
+
+            bool m_paused = false;
+
+            std::size_t m_drawCalls = 0;
+            std::size_t m_drawCallsLastFrame = 0;
+            std::size_t m_allocations = 0;
+            std::size_t m_allocationsLastFrame = 0;
+            std::size_t m_uploads = 0;
+            std::size_t m_uploadsLastFrame = 0;
+
+            static RenderBatch* m_activeBatch;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_BATCH_HPP
@@ -0,0 +1,221 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RING_BUFFER_HPP
+#define TGUI_RING_BUFFER_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Sequence of elements stored in a circular buffer, which can be added and removed at both ends in O(1)
+        ///
+        /// When the buffer is full, its capacity is doubled. When a fixed capacity is reserved and an element is always removed
+        /// before a new one is added, the slot of the removed element is reused, so no memory is allocated and no elements are
+        /// moved. The slots are default constructed when the capacity grows and a removed element is replaced by a default
+        /// constructed one, so that it no longer holds on to its resources.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename T>
+        class RingBuffer
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of elements
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const
+            {
+                return m_size;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of elements that fit in the buffer before it has to grow
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getCapacity() const
+            {
+                return m_slots.size();
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the amount of elements that fit in the buffer, it never becomes smaller than the amount of elements
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setCapacity(std::size_t capacity)
+            {
+                capacity = std::max(capacity, m_size);
+                if (capacity == m_slots.size())
+                    return;
+
+                std::vector<T> slots(capacity);
+                for (std::size_t i = 0; i < m_size; ++i)
+                    slots[i] = std::move((*this)[i]);
+
+                m_slots.swap(slots);
+                m_first = 0;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an element behind the existing ones
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void pushBack(T element)
+            {
+                if (m_size == m_slots.size())
+                    setCapacity(std::max<std::size_t>(2 * m_size, 8));
+
+                m_slots[wrap(m_first + m_size)] = std::move(element);
+                ++m_size;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an element in front of the existing ones
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void pushFront(T element)
+            {
+                if (m_size == m_slots.size())
+                    setCapacity(std::max<std::size_t>(2 * m_size, 8));
+
+                m_first = wrap(m_first + m_slots.size() - 1);
+                m_slots[m_first] = std::move(element);
+                ++m_size;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes the first element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void popFront()
+            {
+                assert(m_size > 0);
+                m_slots[m_first] = T{};
+                m_first = wrap(m_first + 1);
+                --m_size;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes the last element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void popBack()
+            {
+                assert(m_size > 0);
+                --m_size;
+                m_slots[wrap(m_first + m_size)] = T{};
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes an element, the elements on the shortest side of it are moved to fill the gap
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void erase(std::size_t index)
+            {
+                assert(index < m_size);
+                if (index < m_size / 2)
+                {
+                    for (std::size_t i = index; i > 0; --i)
+                        (*this)[i] = std::move((*this)[i - 1]);
+
+                    popFront();
+                }
+                else
+                {
+                    for (std::size_t i = index + 1; i < m_size; ++i)
+                        (*this)[i - 1] = std::move((*this)[i]);
+
+                    popBack();
+                }
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes all elements, the capacity is kept
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear()
+            {
+                std::vector<T>(m_slots.size()).swap(m_slots);
+                m_first = 0;
+                m_size = 0;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the element at the given index, where index 0 is the first element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            T& operator[](std::size_t index)
+            {
+                assert(index < m_size);
+                return m_slots[wrap(m_first + index)];
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the element at the given index, where index 0 is the first element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const T& operator[](std::size_t index) const
+            {
+                assert(index < m_size);
+                return m_slots[wrap(m_first + index)];
+            }
+
+
+        private:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Converts a position that lies less than twice the capacity past the start of the storage to a slot
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t wrap(std::size_t position) const
+            {
+                return (position < m_slots.size()) ? position : position - m_slots.size();
+            }
+
+
+        private:
+
+            std::vector<T> m_slots;
+            std::size_t m_first = 0;
+            std::size_t m_size = 0;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RING_BUFFER_HPP
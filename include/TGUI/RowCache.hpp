@@ -0,0 +1,228 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ROW_CACHE_HPP
+#define TGUI_ROW_CACHE_HPP
+
+
+#include <TGUI/DataSource.hpp>
+#include <SFML/System/Time.hpp>
+#include <unordered_map>
+#include <limits>
+#include <list>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Keeps a bounded amount of the rows of a data source in memory
+        ///
+        /// Rows are fetched in pages of a fixed size. When more pages are loaded than the cache may contain, the page that was
+        /// least recently requested is forgotten, so the memory usage doesn't depend on the size of the data set.
+        /// Fetched rows are collected in a queue that may be filled from any thread, they only become part of the cache when
+        /// applyFetchedRows is called. Callbacks that arrive after the data source was replaced or the cache was destroyed
+        /// are ignored.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API RowCache
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor
+            ///
+            /// @param pageSize  Amount of rows that are fetched at once
+            /// @param maxPages  Maximum amount of pages that are kept in memory
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            RowCache(std::size_t pageSize = 256, std::size_t maxPages = 64);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Copy constructor, which copies the loaded rows but not the fetches that are still in progress
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            RowCache(const RowCache& other);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Overload of copy assignment operator
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            RowCache& operator=(const RowCache& other);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the data source, which forgets all rows that were loaded. Passing nullptr disables the cache.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setDataSource(DataSource::Ptr dataSource);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the data source, or nullptr when none was set
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const DataSource::Ptr& getDataSource() const
+            {
+                return m_dataSource;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the maximum amount of rows that are kept in memory, it is rounded up to a multiple of the page size
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setMaximumRows(std::size_t maxRows);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the maximum amount of rows that are kept in memory
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getMaximumRows() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Asks the data source for its amount of rows
+            ///
+            /// @return True when the row count changed since the last call
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool updateRowCount();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of rows that the data source had during the last call to updateRowCount
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getRowCount() const
+            {
+                return m_rowCount;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns a loaded row, or nullptr when the row isn't in memory
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const sf::String* getRow(std::size_t row) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Marks the rows in the range [firstRow, lastRow) as needed and fetches the ones that aren't loaded yet
+            ///
+            /// The pages containing the rows become the most recently used ones. When the range contains more pages than the
+            /// cache can hold, only the pages in the middle of the range are requested, as the pages would otherwise keep
+            /// replacing each other.
+            ///
+            /// @return True when rows had to be fetched
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool requestRows(std::size_t firstRow, std::size_t lastRow);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds the rows of the fetches that completed since the last call
+            ///
+            /// @return True when rows were added
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool applyFetchedRows();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether rows were requested from the data source that haven't been added yet
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isFetching() const
+            {
+                return !m_pendingPages.empty();
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns how long the widget may wait before checking again whether the fetched rows arrived
+            ///
+            /// While rows are being fetched, the queue is checked a few times per frame instead of continuously, so that the
+            /// gui doesn't keep spinning (which would never end when the data source doesn't call the callback).
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            sf::Time getTimeUntilNextPoll() const
+            {
+                if (isFetching())
+                    return sf::milliseconds(10);
+                else
+                    return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of pages that are currently in memory
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getLoadedPageCount() const
+            {
+                return m_pages.size();
+            }
+
+
+        private:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Forgets all rows and starts collecting fetched rows in a new queue, so that older fetches no longer reach us
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void reset();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Forgets the least recently used pages until the cache is no longer too large
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void evictPages();
+
+
+        private:
+
+            struct Page
+            {
+                std::vector<sf::String> rows;
+                std::list<std::size_t>::iterator usePosition;
+            };
+
+            // Queue in which the data source stores the fetched rows, it is shared with the callbacks of the fetches
+            struct FetchedRows
+            {
+                std::mutex mutex;
+                std::vector<std::pair<std::size_t, std::vector<sf::String>>> pages;
+            };
+
+            DataSource::Ptr m_dataSource;
+            std::size_t m_rowCount = 0;
+            std::size_t m_pageSize;
+            std::size_t m_maxPages;
+
+            std::unordered_map<std::size_t, Page> m_pages;
+            std::list<std::size_t> m_pageUseOrder; // Most recently used page in front
+            std::unordered_map<std::size_t, std::size_t> m_pendingPages; // Amount of rows requested per page
+            std::shared_ptr<FetchedRows> m_fetchedRows;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ROW_CACHE_HPP
@@ -0,0 +1,293 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SEQUENCE_TREE_HPP
+#define TGUI_SEQUENCE_TREE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Sequence in which elements can be inserted and removed at any position in logarithmic time
+        ///
+        /// Elements are referred to by a handle that stays the same while the element exists, no matter how many elements are
+        /// inserted or removed in front of it. Every element stores a number (the payload) and a weight, and can be counted or
+        /// not. Converting between handles, positions and positions among the counted elements, calculating the sum of the
+        /// weights of the first counted elements and finding the counted element that contains an offset all take O(log n)
+        /// time. This is used to keep long lists of rows up-to-date when single items are added, changed or removed.
+        ///
+        /// The sequence is stored as a treap: a binary tree that is balanced by giving every node a random priority.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API SequenceTree
+        {
+        public:
+
+            /// Value of a handle or payload that doesn't refer to anything
+            static constexpr std::size_t None = std::numeric_limits<std::size_t>::max();
+
+            /// Element as passed to the build function
+            struct Element
+            {
+                std::size_t payload;
+                unsigned int weight;
+                bool counted;
+            };
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Replaces the contents of the sequence in linear time
+            ///
+            /// @return Handles of the elements, in the same order as the elements that were passed
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::vector<std::size_t> build(const std::vector<Element>& elements);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes all elements
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Inserts an element in front of the element at the given position and returns its handle
+            ///
+            /// @param position  Position of the new element, which may be equal to the size to add it behind the others
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t insert(std::size_t position, std::size_t payload, unsigned int weight, bool counted);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes an element, its handle may be reused for an element that is inserted later
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void erase(std::size_t handle);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of elements
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const
+            {
+                return (m_root != None) ? m_nodes[m_root].size : 0;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of counted elements
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getCountedSize() const
+            {
+                return (m_root != None) ? m_nodes[m_root].countedSize : 0;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of the weights of the counted elements
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int getCountedWeight() const
+            {
+                return (m_root != None) ? m_nodes[m_root].countedWeight : 0;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns a number that is larger than every handle that is in use
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getHandleLimit() const
+            {
+                return m_nodes.size();
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the handles of all elements in the order of the sequence, in linear time
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::vector<std::size_t> getHandles() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the handle of the element at the given position, which has to be smaller than the size
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t at(std::size_t position) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the handle of the counted element at the given position among the counted elements
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t atCounted(std::size_t countedPosition) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the position of an element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getPosition(std::size_t handle) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of counted elements in front of an element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getCountedPosition(std::size_t handle) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the sum of the weights of the first counted elements
+            ///
+            /// @param count  Amount of counted elements to add together
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int getCountedWeightBefore(std::size_t count) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the largest amount of first counted elements of which the summed weight doesn't exceed the offset
+            ///
+            /// When the weights are the heights of rows, this is the row that contains the offset (or the amount of rows when the
+            /// offset lies below the last row). This matches FenwickTree::findPrefix.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t findCountedAtWeight(unsigned int offset) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of elements in front of the first element for which the function returns true
+            ///
+            /// @param isAfter  Function that is passed the handle of an element. It has to return false for all elements in front
+            ///                 of some position and true for all other elements, like when looking for the insert position of
+            ///                 a value in a sorted sequence.
+            ///
+            /// The function is only called for O(log n) elements.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            template <typename Function>
+            std::size_t findFirst(Function&& isAfter) const
+            {
+                std::size_t position = 0;
+                std::size_t node = m_root;
+                while (node != None)
+                {
+                    if (isAfter(node))
+                        node = m_nodes[node].left;
+                    else
+                    {
+                        position += getSize(m_nodes[node].left) + 1;
+                        node = m_nodes[node].right;
+                    }
+                }
+
+                return position;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the payload of an element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getPayload(std::size_t handle) const
+            {
+                return m_nodes[handle].payload;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the payload of an element
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setPayload(std::size_t handle, std::size_t payload)
+            {
+                m_nodes[handle].payload = payload;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether an element is counted
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isCounted(std::size_t handle) const
+            {
+                return m_nodes[handle].counted;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the weight of an element and whether it is counted
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setWeight(std::size_t handle, unsigned int weight, bool counted);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            struct Node
+            {
+                std::size_t left;
+                std::size_t right;
+                std::size_t parent;
+                std::uint32_t priority;
+                std::size_t payload;
+                unsigned int weight;
+                bool counted;
+
+                // Totals of the subtree of which this node is the root
+                std::size_t size;
+                std::size_t countedSize;
+                unsigned int countedWeight;
+            };
+
+            std::size_t getSize(std::size_t node) const
+            {
+                return (node != None) ? m_nodes[node].size : 0;
+            }
+
+            std::size_t createNode(std::size_t payload, unsigned int weight, bool counted);
+
+            // Recalculates the totals of a node from its children and makes it the parent of its children
+            void updateNode(std::size_t node);
+
+            // Splits a tree in a tree with the first elements and a tree with the other ones
+            void split(std::size_t node, std::size_t count, std::size_t& first, std::size_t& second);
+
+            // Joins two trees, all elements of the second one are placed behind the ones of the first tree
+            std::size_t merge(std::size_t first, std::size_t second);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            std::vector<Node> m_nodes;
+            std::vector<std::size_t> m_freeNodes;
+            std::size_t m_root = None;
+            std::uint32_t m_random = 2463534242; // State of the generator of the priorities
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SEQUENCE_TREE_HPP
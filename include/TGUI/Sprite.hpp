@@ -214,12 +214,24 @@ namespace tgui
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the vertices with the texture, without applying the clipping of the visible rect
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawVertices(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         sf::Vector2f m_size;
         Texture      m_texture;
-        std::vector<sf::Vertex> m_vertices;
+
+        // The texture coordinates are moved while drawing when the texture was moved in or out of the atlas
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable sf::Vector2f m_atlasOffset;
+
+        // Changed together with the vertices, so that a render batch can reuse them when they didn't change
+        mutable std::size_t m_geometryVersion = 0;
 
         sf::FloatRect m_visibleRect;
 
@@ -29,6 +29,7 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/TextStyle.hpp>
+#include <TGUI/TextLayoutCache.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 
@@ -36,6 +37,12 @@
 
 namespace tgui
 {
+    namespace priv
+    {
+        class TextVertexArray;
+        class GlyphMetrics;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Text : public sf::Transformable
@@ -49,10 +56,46 @@ namespace tgui
         /// @param height  Height that the text should fill
         /// @param fit     0 to choose best fit, 1 to select font of at least that height, -1 to select font of maximum that height
         ///
+        /// The result is remembered per font, height and fit, so that widgets with an automatic text size can be resized often.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static unsigned int findBestTextSize(Font font, float height, int fit = 0);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets the results of findBestTextSize
+        ///
+        /// This only has to be called when a font is loaded again while it is being used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearBestTextSizeCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether texts are drawn from signed distance fields instead of the glyph pages of their font
+        ///
+        /// @param enabled  Should the glyphs be rendered once at a base size and scaled to the size of every text?
+        ///
+        /// By default, every character size gets its own glyph texture, which uses a lot of memory when many sizes are used.
+        /// With distance fields, a single atlas per font and style is shared by all sizes and a shader keeps the edges sharp.
+        /// Small text looks slightly softer and the width of texts can differ by a fraction of a pixel from the normal mode.
+        ///
+        /// Enabling this has no effect when shaders aren't supported. It should be called before creating widgets, as existing
+        /// widgets don't recalculate the positions of their texts.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDistanceFieldRendering(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether texts are drawn from signed distance fields
+        ///
+        /// @return False when distance field rendering was never enabled or when shaders aren't supported
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getDistanceFieldRendering();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// The line spacing of a font gives the distance between two lines. There may however be an overlap between the highest
         /// character on the bottom line and the smallest one on the top line. This function calculates that distance.
@@ -218,6 +261,11 @@ namespace tgui
         /// \param target Render target to draw to
         /// \param states Current render states
         ///
+        /// The text is drawn with the glyph page of its font as texture, or with the distance field atlas of the font when distance
+        /// field rendering is enabled. When a render batch is active, the quads of texts that share the same texture are merged
+        /// into a single draw call. The quads themselves come from the
+        /// TextLayoutCache, so texts that display the same string share them.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
@@ -226,19 +274,46 @@ namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Calculates the size of the text again after something changed.
+        // Returns the measured size and glyphs of the text, which are shared with other texts that have the same properties.
+        // Returns nullptr when there is no font.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateSize();
+        const priv::TextLayout* getLayout() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the advances and kerning of the font, which are kept until the font, size or style changes.
+        // The font must not be a nullptr.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::GlyphMetrics& getMetrics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rounds the position in the transform to avoid blurry text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::Transform roundPosition(const sf::Transform& transform);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the texture and shader with which the vertices of the layout have to be drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void selectTexture(sf::RenderStates& states, const priv::TextLayout& layout, sf::Font& font, unsigned int characterSize);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
-        sf::Vector2f m_size;
+        sf::String   m_string;
+        unsigned int m_characterSize = 30;
+        TextStyle    m_style = sf::Text::Regular;
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        mutable std::shared_ptr<const priv::TextLayout> m_layout; // Only looked up again when needed after a property changed
+        mutable priv::GlyphMetrics* m_metrics = nullptr; // Owned by the metrics cache, which keeps them while the font exists
+        mutable bool m_metricsDistanceField = false;
+
+        friend class priv::TextVertexArray;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_LAYOUT_CACHE_HPP
+#define TGUI_TEXT_LAYOUT_CACHE_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <TGUI/TextStyle.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        class DistanceFieldFont;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Measured size and glyph quads of a string, shared between all texts that display the same string
+        ///
+        /// The vertices are white, the color of the text is applied when drawing them. When distance field rendering was enabled
+        /// while the layout was created, the texture coordinates refer to the atlas of the distance fields instead of the font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API TextLayout
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Measures the string
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TextLayout(const std::shared_ptr<sf::Font>& font, const sf::String& string, unsigned int characterSize, TextStyle style);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the size that is needed to draw the text
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            sf::Vector2f getSize() const
+            {
+                return m_size;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the string that was measured
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const sf::String& getString() const
+            {
+                return m_string;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the triangles of the glyphs, which are created the first time the text is drawn
+            ///
+            /// @param font  Font that was passed to the constructor
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const std::vector<sf::Vertex>& getVertices(const sf::Font& font) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the version under which the vertices are passed to a render batch
+            ///
+            /// The vertices never change once they are created, so the version stays the same during the lifetime of the layout.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getVersion() const
+            {
+                return m_version;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the distance fields from which the text is drawn, or nullptr when it is drawn from the font texture
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            DistanceFieldFont* getDistanceField() const
+            {
+                return m_distanceField;
+            }
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Checks whether this layout was created with the given parameters and the current rendering mode
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool matches(const std::shared_ptr<sf::Font>& font, const sf::String& string, unsigned int characterSize, TextStyle style) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns a rough estimate of the memory used by the layout
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getMemoryEstimate() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            std::weak_ptr<sf::Font> m_font;
+            sf::String m_string;
+            unsigned int m_characterSize;
+            sf::Uint32 m_style;
+            sf::Vector2f m_size;
+            DistanceFieldFont* m_distanceField = nullptr;
+            std::size_t m_version;
+
+            mutable std::vector<sf::Vertex> m_vertices;
+            mutable bool m_verticesCreated = false;
+        };
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Process-wide cache of the measured size and glyph layout of texts
+    ///
+    /// Every text asks this cache for its layout, so that identical strings (e.g. "OK" on every button, or the same items in
+    /// multiple list boxes) are only measured once and share their geometry. The least recently used layouts are removed from
+    /// the cache when it uses more memory than the budget. Texts that still use a removed layout keep it alive.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextLayoutCache
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of memory that the cache may use
+        ///
+        /// @param bytes  Maximum memory usage of the cached layouts, 0 disables the cache. The default budget is 4 MB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMemoryBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the cache may use
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMemoryBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an estimate of the memory that is currently used by the cached layouts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a layout was found in the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getHitCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a layout had to be created because it wasn't in the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMissCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the hit and miss counters back to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all layouts from the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the layout of a string, creating it when it wasn't cached yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<const priv::TextLayout> getLayout(const std::shared_ptr<sf::Font>& font, const sf::String& string,
+                                                                 unsigned int characterSize, TextStyle style);
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_LAYOUT_CACHE_HPP
@@ -0,0 +1,167 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_RELAYOUT_PASS_HPP
+#define TGUI_TEXT_RELAYOUT_PASS_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        class WordWrapper;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the texts that have to be word-wrapped again after a layout change and wraps them on multiple threads
+    ///
+    /// While a pass is active, labels and text boxes don't wrap their text immediately when their size changes. Instead they
+    /// queue their word wrapper. When the pass ends, the queued texts are wrapped on worker threads, after which the widgets
+    /// update their lines on the calling thread, in the order in which they were queued. When updating a widget causes other
+    /// widgets to be resized, their texts are wrapped in a next round, until no more texts are queued.
+    ///
+    /// The result is identical to wrapping every text immediately. The gui starts a pass when its view is changed, so that
+    /// resizing the window wraps all texts in parallel. You can start a pass yourself when changing many widgets at once:
+    /// @code
+    /// {
+    ///     tgui::TextRelayoutPass::Scope pass;
+    ///     for (auto& label : labels)
+    ///         label->setSize(width, label->getSize().y);
+    /// } // The texts are wrapped here
+    /// @endcode
+    ///
+    /// The size of an auto-sized label is only updated at the end of the pass.
+    /// All functions must be called from the thread that owns the gui.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextRelayoutPass
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a pass in its constructor and ends it in its destructor
+        ///
+        /// Passes can be nested, the texts are wrapped when the outermost pass ends.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope
+        {
+        public:
+            Scope();
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a pass is active and wrapping requests are being collected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of threads that are used to wrap the texts, including the calling thread
+        ///
+        /// @param threadCount  Amount of threads, or 0 to use the amount of cores (default)
+        ///
+        /// When set to 1, the texts are wrapped on the calling thread. Changing the amount stops the worker threads, they are
+        /// started again with the new amount the next time that they are needed. The same threads are used to sort the items
+        /// of list boxes, so this amount also applies there.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setThreadCount(unsigned int threadCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of threads that are used to wrap the texts
+        ///
+        /// @return Amount of threads that will be used, this is never 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getThreadCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Wraps the text of a word wrapper now or at the end of the pass
+        ///
+        /// @param wordWrapper  Word wrapper of which the getLines function has to be called
+        /// @param onWrapped    Function to call on the calling thread once the lines are available
+        ///
+        /// When no pass is active, onWrapped is called immediately. Otherwise the word wrapper is queued, or its callback is
+        /// replaced if it was already queued.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Function>
+        static void requestWrap(priv::WordWrapper& wordWrapper, Function&& onWrapped)
+        {
+            if (isActive())
+                queue(wordWrapper, std::forward<Function>(onWrapped));
+            else
+                onWrapped();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Removes a word wrapper from the queue, called when the word wrapper is destroyed or overwritten
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void cancel(const priv::WordWrapper& wordWrapper);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Calls a function for every index in the range [0, count) on the worker threads
+        ///
+        /// @param count           Amount of times the function has to be called
+        /// @param characterCount  Amount of characters (or items) that will be processed in total, small jobs stay on the calling thread
+        /// @param function        Function to call, which must be safe to call from multiple threads for different indices
+        /// @param prepare         Function that is called for every index on the calling thread before any threads are started
+        ///
+        /// This function only returns when all calls are finished. The worker threads are started the first time they are needed
+        /// and then wait for the next call. While they are running, the glyph metrics are read-only, so the prepare function
+        /// should preload the glyphs of the text that the function will measure.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void parallelFor(std::size_t count, std::size_t characterCount, const std::function<void(std::size_t)>& function,
+                                const std::function<void(std::size_t)>& prepare = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static void begin();
+        static void end();
+        static void queue(priv::WordWrapper& wordWrapper, std::function<void()> onWrapped);
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_RELAYOUT_PASS_HPP
@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_VERTEX_ARRAY_HPP
+#define TGUI_TEXT_VERTEX_ARRAY_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Text;
+
+    namespace priv
+    {
+        class TextLayout;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Glyph quads of several texts that are drawn together
+        ///
+        /// Widgets that display many lines, like Label and TextBox, add their lines once after the text changed instead of
+        /// drawing every line separately. The color of each text is baked into the vertices. The positions are only baked
+        /// when drawing, because each text is placed on whole pixels after being combined with the transform of the widget,
+        /// just like when the text would have been drawn on its own.
+        ///
+        /// All texts that are added must use the same font, character size and style, as they are drawn with one texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API TextVertexArray
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Removes all texts
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void clear();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds the glyphs of a text, at its current position and in its current color
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addText(const Text& text);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the color of all glyphs that were added
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setColor(sf::Color color);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Draws all texts with a single draw call
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            struct Line
+            {
+                sf::Transform transform; // Unrounded transform of the text
+                std::size_t vertexCount;
+            };
+
+            std::vector<sf::Vertex> m_vertices; // Positions relative to the text they belong to
+            std::vector<Line> m_lines;
+            mutable std::vector<sf::Vertex> m_transformedVertices; // Vertices at their position on the target
+            mutable sf::Transform m_transform; // Transform with which the transformed vertices were calculated
+            mutable bool m_transformedVerticesValid = false;
+            std::shared_ptr<const TextLayout> m_layout; // Layout of the first text, which tells which texture has to be used
+            Font m_font;
+            unsigned int m_characterSize = 0;
+            mutable std::size_t m_version = 0; // Changed with the transformed vertices, so that a render batch can reuse them
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_VERTEX_ARRAY_HPP
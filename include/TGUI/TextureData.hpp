@@ -49,6 +49,11 @@ namespace tgui
         std::unique_ptr<sf::Image> image;
         sf::Texture texture;
         sf::IntRect rect;
+
+        // When the image was packed in a texture atlas then the texture member is left empty and the image is
+        // found in the atlas page at the given rectangle instead
+        std::shared_ptr<sf::Texture> atlasTexture;
+        sf::IntRect atlasRect;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
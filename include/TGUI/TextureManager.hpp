@@ -32,6 +32,7 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -79,10 +80,124 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images that are loaded from now on are packed together in shared atlas textures
+        ///
+        /// @param enabled  Should newly loaded images be put in a texture atlas?
+        ///
+        /// When the atlas is enabled, all images (or parts of images) that are small enough are copied into a few large
+        /// atlas pages instead of each getting their own texture. Widgets that use images from the same page can then be
+        /// drawn with a single draw call. Textures that were already loaded are not affected by this setting.
+        ///
+        /// Images that are too large for a page and textures that are made smooth are still stored in separate textures.
+        ///
+        /// The atlas is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images that are loaded are packed together in shared atlas textures
+        ///
+        /// @return Is the texture atlas enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width and height of new atlas pages
+        ///
+        /// @param size  Size of the pages, which will be limited to the maximum texture size supported by the graphics card
+        ///
+        /// The default page size is 1024x1024.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasPageSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of new atlas pages
+        ///
+        /// @return Size of the pages
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getAtlasPageSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of pixels that are kept free around every image in the atlas
+        ///
+        /// @param padding  Space around each image
+        ///
+        /// The padding is filled with the pixels on the edge of the image, so that neighbouring images don't bleed into
+        /// each other when the image is scaled. The default padding is 1 pixel.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasPadding(unsigned int padding);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of pixels that are kept free around every image in the atlas
+        ///
+        /// @return Space around each image
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getAtlasPadding();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of atlas pages that are currently in use
+        ///
+        /// @return Number of atlas textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getAtlasPageCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Moves texture data out of the atlas into its own texture
+        ///
+        /// @param data  Texture data that was packed in an atlas page
+        ///
+        /// This is needed when the texture has to be smooth, as this property applies to the entire atlas page.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeFromAtlas(TextureData& data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tries to copy the image into one of the atlas pages. Returns false when the image couldn't be placed in the atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool addToAtlas(TextureData& data);
+
+        // Row of images inside an atlas page
+        struct AtlasShelf
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int usedWidth;
+        };
+
+        // Texture in which many images are packed. The page only stays alive while texture data is referencing it.
+        struct AtlasPage
+        {
+            std::weak_ptr<sf::Texture> texture;
+            unsigned int size;
+            std::vector<AtlasShelf> shelves;
+        };
+
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+
+        static std::list<AtlasPage> m_atlasPages;
+        static bool m_atlasEnabled;
+        static unsigned int m_atlasPageSize;
+        static unsigned int m_atlasPadding;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
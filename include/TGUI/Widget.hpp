@@ -379,6 +379,17 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns true when the mouse is currently on top of the widget
+        ///
+        /// @return Is the mouse hovering over the widget?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseHovered() const
+        {
+            return m_mouseHover;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the type of the widget
         ///
@@ -414,6 +425,18 @@ namespace tgui
         virtual void moveToBack();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the parents of the widget that the widget has changed and has to be redrawn
+        ///
+        /// The widgets call this function themselves when one of their properties changes. Custom widgets should call it
+        /// whenever something changes that affects how they are drawn, otherwise a parent with a render cache will keep
+        /// showing the old image of the widget.
+        ///
+        /// @see Container::setRenderCacheEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the font of the widget that is used when no font is set in the renderer
         ///
@@ -477,6 +500,15 @@ namespace tgui
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how long it takes until the update function will change how the widget looks.
+        /// Zero is returned when the widget changes every frame (e.g. during an animation) and the maximum time value is returned
+        /// when the widget will not change by itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -743,6 +775,14 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // This is set to true for widgets of which the draw function is known to flush the render batch before drawing
+        // directly on the target. Other widgets (e.g. custom widgets) are drawn with batching suspended.
+        bool m_batchedDrawing = false;
+
+        // This is set to false for widgets that draw outside of their full size (e.g. the open menus of a menu bar).
+        // Other widgets are not drawn when they lie completely outside the clipping area of their parent.
+        bool m_allowCulling = true;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
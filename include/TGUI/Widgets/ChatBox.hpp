@@ -30,7 +30,10 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
-#include <deque>
+#include <TGUI/CompactString.hpp>
+#include <TGUI/RowCache.hpp>
+#include <TGUI/RingBuffer.hpp>
+#include <utility>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,7 +54,9 @@ namespace tgui
         struct Line
         {
             Text text;
-            sf::String string;
+            priv::CompactString string; // Original text before word wrapping
+            float height = 0; // Height of the text after word wrapping
+            double top = 0; // Sum of the heights of the lines above it, plus the position of the first line (which isn't always 0)
         };
 
 
@@ -363,6 +368,76 @@ namespace tgui
         bool getNewLinesBelowOthers() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the rows of a data source instead of the lines that were added to the chat box
+        ///
+        /// @param dataSource  Object that provides the rows, or nullptr to show the lines of the chat box again
+        ///
+        /// Only the rows that are visible, or that are within the prefetch distance of the visible rows, are requested from
+        /// the data source and only a limited amount of rows is kept in memory, so the data set can be arbitrarily large.
+        /// Each row is shown as a single line with the default text size and color, without word wrapping, so that the
+        /// position of every row is known before it is fetched. Rows that haven't arrived yet are shown empty.
+        /// The first row of the data source is shown at the top.
+        ///
+        /// The lines that were added to the chat box are kept, but they aren't shown while a data source is set.
+        /// Calling this function again with the same data source forgets the rows that were already loaded.
+        ///
+        /// @see onRowsNeeded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDataSource(DataSource::Ptr dataSource);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the data source that provides the rows
+        ///
+        /// @return Data source, or nullptr when the chat box shows its own lines
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DataSource::Ptr getDataSource() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how many rows above and below the visible ones are already fetched from the data source
+        ///
+        /// @param rowCount  Amount of rows to load in advance on each side of the visible rows
+        ///
+        /// The prefetch distance is 50 rows by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPrefetchDistance(std::size_t rowCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many rows above and below the visible ones are already fetched from the data source
+        ///
+        /// @return Amount of rows that are loaded in advance on each side of the visible rows
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPrefetchDistance() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how many rows of the data source are kept in memory
+        ///
+        /// @param rowCount  Maximum amount of rows to keep, it is rounded up to a multiple of 256
+        ///
+        /// The rows that were needed least recently are forgotten first. The limit should be large enough to contain the
+        /// visible rows together with twice the prefetch distance. By default 16384 rows are kept.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumCachedRows(std::size_t rowCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many rows of the data source are kept in memory
+        ///
+        /// @return Maximum amount of rows that are kept
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMaximumCachedRows() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -423,6 +498,31 @@ namespace tgui
         void recalculateFullTextHeight();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the line that contains the given vertical offset, clamped to the first and last lines.
+        // There has to be at least one line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLineAtOffset(double offset) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the height of the lines or of the rows of the data source
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        double getShownTextHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a line that is known to exist and moves the lines that have to close the gap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseLine(std::size_t lineIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the maximum of the scrollbar after the height of the text changed and keeps it at the bottom if needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbarMaximum();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position of the lines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,6 +535,18 @@ namespace tgui
         void updateRendering();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the height of a single row of the data source
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getDataSourceRowHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the rows that were fetched from the data source and fetches the rows that are about to become visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDataSourceRows();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -448,6 +560,18 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves a signal based on its name
+        ///
+        /// @param signalName  Name of the signal
+        ///
+        /// @return Signal that corresponds to the name
+        ///
+        /// @throw Exception when the name does not match any signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal& getSignal(std::string signalName) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
@@ -463,6 +587,25 @@ namespace tgui
         sf::Vector2f getInnerSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the indices of the first and last lines that are visible at the current scrollbar value.
+        // There has to be at least one line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::pair<std::size_t, std::size_t> getVisibleLines() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long it takes until the update function will change how the widget looks.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,6 +615,12 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        SignalRange onRowsNeeded = {"RowsNeeded"}; ///< Rows of the data source are about to become visible and are being fetched. Optional parameters: first and last row
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -480,14 +629,22 @@ namespace tgui
 
         std::size_t m_maxLines = 0;
 
-        float m_fullTextHeight = 0;
+        // Sum of the heights of all lines, adjusted when a line is added or removed
+        double m_fullTextHeight = 0;
 
         bool m_linesStartFromTop = false;
         bool m_newLinesBelowOthers = true;
 
         ScrollbarChildWidget m_scroll;
 
-        std::deque<Line> m_lines;
+        // Once the line limit is reached, the capacity of the buffer is fixed and the oldest line is replaced by the newest one
+        priv::RingBuffer<Line> m_lines;
+
+        // Rows that were loaded from the data source when one was set, only the visible rows have a text
+        priv::RowCache m_rowCache;
+        std::size_t m_prefetchDistance = 50;
+        std::vector<Text> m_dataSourceTexts;
+        std::size_t m_firstDataSourceRow = 0;
 
         Sprite m_spriteBackground;
 
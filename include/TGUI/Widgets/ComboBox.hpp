@@ -409,7 +409,7 @@ namespace tgui
         /// Items that were not given an id simply have an empty string as id.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<sf::String>& getItemIds();
+        std::vector<sf::String> getItemIds();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -555,6 +555,12 @@ namespace tgui
         void hideListBox();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Shows the item that is selected in the list box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectedText();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Initialize the internal list box
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
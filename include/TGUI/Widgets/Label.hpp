@@ -30,6 +30,8 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Renderers/LabelRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/TextVertexArray.hpp>
+#include <TGUI/WordWrapper.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -339,6 +341,12 @@ namespace tgui
         void rearrangeText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the lines from the word wrapper and updates their positions and the size of the label.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines(float maxWidth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -358,7 +366,8 @@ namespace tgui
     protected:
 
         sf::String m_string;
-        std::vector<Text> m_lines;
+        priv::TextVertexArray m_textVertices; // Glyphs of all lines
+        priv::WordWrapper m_wordWrapper;
 
         unsigned int m_textSize = 18;
         HorizontalAlignment m_horizontalAlignment = HorizontalAlignment::Left;
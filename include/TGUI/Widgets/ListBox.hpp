@@ -30,6 +30,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/ItemView.hpp>
+#include <TGUI/RowCache.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -135,6 +137,7 @@ namespace tgui
         /// @return
         ///         - true on success
         ///         - false when none of the items matches the name
+        ///         - false when a data source is set, its rows can only be selected by index
         ///
         /// @see setSelectedItemById
         ///
@@ -152,6 +155,7 @@ namespace tgui
         /// @return
         ///         - true on success
         ///         - false when none of the items has the given id
+        ///         - false when a data source is set, its rows can only be selected by index
         ///
         /// @see setSelectedItem
         ///
@@ -162,7 +166,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list box
         ///
-        /// @param index  Index of the item in the list box
+        /// @param index  Index of the item in the list box, or of the row when a data source is set
         ///
         /// @return
         ///         - true on success
@@ -231,6 +235,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes all items from the list
         ///
+        /// While a data source is set, this only removes the items that were added to the list box. The rows of the data source
+        /// and the selected row remain unchanged.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeAllItems();
 
@@ -328,6 +335,9 @@ namespace tgui
         ///
         /// @return Number of items inside the list box
         ///
+        /// This is the amount of items that were added to the list box, also while a data source is set and the items aren't
+        /// shown. The amount of rows in the data source is returned by getShownItemCount.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::size_t getItemCount() const;
 
@@ -349,7 +359,65 @@ namespace tgui
         /// Items that were not given an id simply have an empty string as id.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<sf::String>& getItemIds() const;
+        std::vector<sf::String> getItemIds() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order in which the items are shown
+        ///
+        /// @param comparator  Function that returns whether the first item should be shown above the second one,
+        ///                    or nullptr to show the items in the order in which they were added
+        ///
+        /// The order is kept when items are added, removed or changed afterwards. All items are sorted immediately, which
+        /// happens on multiple threads when the list is long, so the comparator must be safe to call from different threads.
+        ///
+        /// The indices that are passed to and returned by the other functions still refer to the order in which the items
+        /// were added, the sort order only influences how the items are displayed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSortComparator(std::function<bool(const sf::String& left, const sf::String& right)> comparator);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text
+        ///
+        /// @param text  Text that has to be part of the items to show them (case-sensitive), or an empty string to show all items
+        ///
+        /// The items that are filtered out still exist, they are just not displayed. Items that are added or changed later
+        /// are also filtered. The list box keeps an index of the items so that calling this function again while the filter
+        /// is being typed doesn't have to look at every item.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilter(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items for which the given function returns true
+        ///
+        /// @param predicate  Function that is called with the text of an item, or nullptr to show all items
+        ///
+        /// Unlike with setFilter, the function has to be called for every item each time the filter is changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterPredicate(std::function<bool(const sf::String& item)> predicate);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that was passed to setFilter
+        ///
+        /// @return Text with which the items are filtered, or an empty string when no text filter is used
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getFilter() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that are displayed, which are the items that aren't filtered out
+        ///
+        /// @return Number of shown items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getShownItemCount() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -357,6 +425,9 @@ namespace tgui
         ///
         /// @param itemHeight  The size of a single item in the list
         ///
+        /// This height is given to all existing items, including those that were given a different height with
+        /// setItemHeightByIndex, and to the items that are added afterwards.
+        ///
         /// @warning When there is no scrollbar then the items will be removed when they no longer fit inside the list box
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,6 +443,34 @@ namespace tgui
         unsigned int getItemHeight() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the height of a single item
+        ///
+        /// @param index       The index of the item of which the height should be changed
+        /// @param itemHeight  The new height of the item
+        ///
+        /// @return
+        ///        - true when the height was changed
+        ///        - false when the index was too high
+        ///
+        /// This can be used for items that need more space than the others. Changing the height of an item doesn't depend
+        /// on the amount of items in the list, the items behind it don't have to be repositioned.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemHeightByIndex(std::size_t index, unsigned int itemHeight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the height of a single item
+        ///
+        /// @param index  The index of the item
+        ///
+        /// @return The height of the item, or 0 when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getItemHeightByIndex(std::size_t index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the text size of the items
         ///
@@ -438,6 +537,76 @@ namespace tgui
         bool getAutoScroll() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the rows of a data source instead of the items that were added to the list box
+        ///
+        /// @param dataSource  Object that provides the rows, or nullptr to show the items of the list box again
+        ///
+        /// Only the rows that are visible, or that are within the prefetch distance of the visible rows, are requested from
+        /// the data source and only a limited amount of rows is kept in memory, so the data set can be arbitrarily large.
+        /// Rows that haven't arrived yet are shown empty. All rows have the height that was set with setItemHeight and they are
+        /// neither sorted nor filtered. Rows are selected by index, they don't have an id.
+        ///
+        /// The items that were added to the list box are kept, but they aren't shown while a data source is set. They can
+        /// still be added, changed and removed, which doesn't affect the selected row or the scrollbar.
+        /// Calling this function again with the same data source forgets the rows that were already loaded.
+        ///
+        /// @see onRowsNeeded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDataSource(DataSource::Ptr dataSource);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the data source that provides the rows
+        ///
+        /// @return Data source, or nullptr when the list box shows its own items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DataSource::Ptr getDataSource() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how many rows above and below the visible ones are already fetched from the data source
+        ///
+        /// @param rowCount  Amount of rows to load in advance on each side of the visible rows
+        ///
+        /// The prefetch distance is 50 rows by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPrefetchDistance(std::size_t rowCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many rows above and below the visible ones are already fetched from the data source
+        ///
+        /// @return Amount of rows that are loaded in advance on each side of the visible rows
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPrefetchDistance() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how many rows of the data source are kept in memory
+        ///
+        /// @param rowCount  Maximum amount of rows to keep, it is rounded up to a multiple of 256
+        ///
+        /// The rows that were needed least recently are forgotten first. The limit should be large enough to contain the
+        /// visible rows together with twice the prefetch distance. By default 16384 rows are kept.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumCachedRows(std::size_t rowCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many rows of the data source are kept in memory
+        ///
+        /// @return Maximum amount of rows that are kept
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMaximumCachedRows() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -518,27 +687,48 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Update on which item the mouse is standing
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedAndHoveringItemColorsAndStyle();
+        void updateHoveringItem(int item);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the color and text style of all the items
+        // Update which item is selected
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateItemColorsAndStyle();
+        void updateSelectedItem(int item);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update on which item the mouse is standing
+        // Forgets the texts of the visible items, they are recreated with the current properties the next time they are drawn
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateHoveringItem(int item);
+        void resetVisibleItems();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update which item is selected
+        // Returns the text that displays the item, with the color and style that depend on whether it is selected or hovered.
+        // The item has to be visible and the pool of texts has to be large enough to contain all visible rows.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedItem(int item);
+        const Text& getVisibleItemText(std::size_t row, std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Functions that find the rows in the view on the items or, when a data source is set, in the rows of the data source
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRowCount() const;
+        std::size_t getItemIndex(std::size_t row) const;
+        std::size_t findRow(std::size_t index) const;
+        std::size_t findRowAtOffset(unsigned int offset) const;
+        unsigned int getRowTop(std::size_t row) const;
+        unsigned int getRowHeight(std::size_t index) const;
+        unsigned int getTotalRowHeight() const;
+        sf::String getItemText(std::size_t index) const;
+        sf::String getItemId(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the rows that were fetched from the data source and fetches the rows that are about to become visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDataSourceRows();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -547,6 +737,12 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long it takes until the update function will change how the widget looks.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -563,14 +759,27 @@ namespace tgui
         SignalItem onMousePress   = {"MousePressed"};   ///< The mouse went down on an item. Optional parameter: selected item
         SignalItem onMouseRelease = {"MouseReleased"};  ///< The mouse was released on one of the items. Optional parameter: selected item
         SignalItem onDoubleClick  = {"DoubleClicked"};  ///< An item was double clicked. Optional parameter: selected item
+        SignalRange onRowsNeeded  = {"RowsNeeded"};     ///< Rows of the data source are about to become visible and are being fetched. Optional parameters: first and last row
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        // This contains the different items in the list box
-        std::vector<Text>       m_items;
-        std::vector<sf::String> m_itemIds;
+        // This contains the different items in the list box. Only the strings are stored, a text is only created for the
+        // items that are visible, so adding an item is cheap and the memory per item doesn't depend on the font.
+        // Items can be found by name or id without looping over all of them.
+        priv::IndexedItemList m_items;
+
+        // Order in which the items are shown, when they are sorted or filtered
+        priv::ItemView m_view;
+
+        // Rows that were loaded from the data source, when one was set
+        priv::RowCache m_rowCache;
+        std::size_t m_prefetchDistance = 50;
+
+        // Texts that are reused for the visible items, the item in row i is shown by the text at i % m_visibleItemTexts.size()
+        mutable std::vector<Text> m_visibleItemTexts;
+        mutable std::vector<std::size_t> m_visibleItemIndices;
 
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
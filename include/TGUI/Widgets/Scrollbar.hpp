@@ -29,6 +29,7 @@
 
 #include <TGUI/Widget.hpp>
 #include <TGUI/Renderers/ScrollbarRenderer.hpp>
+#include <tuple>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -398,6 +399,17 @@ namespace tgui
         bool isShown() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the value, hover state and thumb position, which change while the user interacts with the scrollbar
+        ///
+        /// The scrollbar isn't part of the widget tree, so its own invalidate calls don't reach the widget that owns it. The
+        /// owner compares the states from before and after passing on an event to find out whether it has to be redrawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::tuple<unsigned int, bool, int, float, float> getInteractionState() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -30,6 +30,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/TextVertexArray.hpp>
+#include <TGUI/WordWrapper.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -360,12 +362,24 @@ namespace tgui
         void rearrangeText(bool keepSelection);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text in lines as decided by the word wrapper, and updates the selection and scrollbar.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines(bool keepSelection, std::pair<std::size_t, std::size_t> textSelectionPositions);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will split the text into five pieces so that the text can be easily drawn.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the glyphs of the five selection texts so that they can be drawn together.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextVertices();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -391,6 +405,12 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how long it takes until the update function will change how the widget looks.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the positions of the contents of the text box.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,6 +467,7 @@ namespace tgui
         unsigned int m_lineHeight = 24;
 
         std::vector<sf::String> m_lines;
+        priv::WordWrapper m_wordWrapper;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -468,6 +489,7 @@ namespace tgui
         Text m_textSelection2;
         Text m_textAfterSelection1;
         Text m_textAfterSelection2;
+        priv::TextVertexArray m_textVertices; // Glyphs of the five texts above
 
         std::vector<sf::FloatRect> m_selectionRects;
 
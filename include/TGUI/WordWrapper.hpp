@@ -0,0 +1,244 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WORD_WRAPPER_HPP
+#define TGUI_WORD_WRAPPER_HPP
+
+
+#include <TGUI/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class TextRelayoutPass;
+
+    namespace priv
+    {
+        class GlyphMetrics;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Splits a text in lines that fit within a maximum width, while remembering the result per paragraph
+        ///
+        /// The lines are identical to what Text::wordWrap would produce, but they are returned as index ranges in the text.
+        ///
+        /// Every paragraph (part of the text between newlines) keeps its lines together with the range of widths for which
+        /// they would stay the same. When the maximum width changes, only the paragraphs for which the width falls outside
+        /// this range are wrapped again. When the text changes, only the paragraphs between the first and last changed
+        /// character are wrapped again.
+        ///
+        /// Different word wrappers can be used on different threads at the same time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API WordWrapper
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Part of the text that is shown on a single line
+            ///
+            /// The newline character that ends the line is not part of the range.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            struct Line
+            {
+                std::size_t begin;
+                std::size_t end;
+            };
+
+
+            WordWrapper() = default;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Copy constructor
+            ///
+            /// The copy is never queued in a relayout pass, its owner has to request the wrapping again when needed.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            WordWrapper(const WordWrapper& other);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Move constructor
+            ///
+            /// The word wrapper that is moved from loses its text and is removed from the relayout pass.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            WordWrapper(WordWrapper&& other);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Overload of copy assignment operator
+            ///
+            /// A request to wrap the old text is cancelled, as its callback would use the lines of the new text.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            WordWrapper& operator=(const WordWrapper& other);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Move assignment
+            ///
+            /// Requests to wrap the old text of either word wrapper are cancelled.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            WordWrapper& operator=(WordWrapper&& other);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Destructor, which removes the word wrapper from the relayout pass when it was still queued
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~WordWrapper();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the font that is used to measure the text
+            ///
+            /// @param font      Font of the text
+            /// @param textSize  Character size of the text
+            /// @param bold      Is the text drawn in bold?
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setFont(Font font, unsigned int textSize, bool bold);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes whether a single space at the beginning of a wrapped line should be moved to the previous line
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setDropLeadingSpace(bool dropLeadingSpace);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the text that has to be wrapped
+            ///
+            /// The paragraphs in front of and behind the changed part of the text keep their lines.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setText(const sf::String& text);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the text that is being wrapped
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const sf::String& getText() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the maximum width of a line
+            ///
+            /// @param maxWidth  Maximum width, or 0 to only break lines at the newlines in the text
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setMaximumWidth(float maxWidth);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the lines of the text, wrapping the paragraphs that changed since the last call
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const std::vector<Line>& getLines();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Loads the glyphs that the next call to getLines will measure
+            ///
+            /// This has to be called on the thread that owns the font when getLines will be called on another thread.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void preloadGlyphs();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of paragraphs that had to be wrapped during the last call to getLines
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getWrappedParagraphCount() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            struct Paragraph
+            {
+                std::size_t begin = 0;
+                std::size_t end = 0; // Position of the newline or the end of the text
+                std::vector<Line> lines;
+                float minWidth = 0; // The lines remain the same for widths in the range [minWidth, maxWidth)
+                float maxWidth = 0;
+                bool wrapped = false;
+            };
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Splits the text in paragraphs, reusing the paragraphs outside the range that was changed
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void updateParagraphs(std::size_t unchangedPrefix, std::size_t unchangedSuffix);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns the glyph metrics of the font, or nullptr when there is no font
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            GlyphMetrics* getMetrics();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Finds the lines of a single paragraph
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void wrapParagraph(Paragraph& paragraph, GlyphMetrics* metrics) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Removes the word wrapper from the relayout pass if it was queued
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void cancelRelayout();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Returns to the state of a default constructed word wrapper after the contents were moved away
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void resetAfterMove();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            sf::String m_text;
+            Font m_font;
+            unsigned int m_textSize = 0;
+            bool m_bold = false;
+            bool m_dropLeadingSpace = true;
+            float m_maxWidth = 0;
+
+            std::vector<Paragraph> m_paragraphs = std::vector<Paragraph>(1);
+            std::vector<Line> m_lines;
+            bool m_linesNeedUpdate = true;
+            std::size_t m_wrappedParagraphCount = 0;
+            GlyphMetrics* m_metrics = nullptr; // Cached so that wrapping doesn't have to look up the metrics of the font every time
+            bool m_metricsDistanceField = false;
+
+            bool m_relayoutQueued = false; // Only accessed by TextRelayoutPass, on the thread that owns the gui
+            std::size_t m_relayoutJob = 0; // Index of the queued job, so that TextRelayoutPass doesn't have to search for it
+
+            friend class tgui::TextRelayoutPass;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WORD_WRAPPER_HPP
@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WORKER_POOL_HPP
+#define TGUI_WORKER_POOL_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Threads that are shared by everything in the library that splits its work over multiple cores
+        ///
+        /// The threads are started the first time they are needed and then wait for the next call to parallelFor.
+        /// All functions must be called from the thread that owns the gui, parallelFor can't be called from within itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API WorkerPool
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Changes the maximum amount of threads that are used, including the calling thread
+            ///
+            /// @param threadCount  Amount of threads, or 0 to use the amount of cores (default)
+            ///
+            /// When set to 1, everything runs on the calling thread. Changing the amount stops the worker threads, they are
+            /// started again with the new amount the next time that they are needed.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void setThreadCount(unsigned int threadCount);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the maximum amount of threads that are used, this is never 0
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static unsigned int getThreadCount();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether parallelFor would use the worker threads for the given job
+            ///
+            /// @param count     Amount of times the function would be called
+            /// @param workSize  Amount of characters or items that would be processed in total
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static bool isWorthUsingThreads(std::size_t count, std::size_t workSize);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Calls a function for every index in the range [0, count) on the worker threads and the calling thread
+            ///
+            /// @param count     Amount of times the function has to be called
+            /// @param workSize  Amount of characters or items that will be processed in total, small jobs stay on the calling thread
+            /// @param function  Function to call, which must be safe to call from multiple threads for different indices
+            ///
+            /// This function only returns when all calls are finished.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void parallelFor(std::size_t count, std::size_t workSize, const std::function<void(std::size_t)>& function);
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WORKER_POOL_HPP
@@ -0,0 +1,213 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    priv::ClippingStack* Clipping::m_activeStack = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipping::Clipping(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size) :
+        m_target(target)
+    {
+        const sf::Vector2i topLeftPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft));
+        const sf::Vector2i bottomRightPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft + size));
+
+        // Get the old clipping area. While the gui is drawing, it is kept on the stack so that OpenGL doesn't have to be queried.
+        if (m_activeStack && (m_activeStack->target == &target))
+        {
+            m_stack = m_activeStack;
+            m_oldArea = m_stack->areas.back();
+        }
+        else
+        {
+            GLint scissor[4];
+            glGetIntegerv(GL_SCISSOR_BOX, scissor);
+            m_oldArea = {scissor[0], scissor[1], scissor[2], scissor[3]};
+        }
+
+        // Calculate the clipping area
+        const int targetHeight = static_cast<int>(target.getSize().y);
+        const int scissorLeft = std::max(topLeftPosition.x, m_oldArea.left);
+        const int scissorBottom = std::min(bottomRightPosition.y, targetHeight - m_oldArea.top);
+        int scissorTop = std::max(topLeftPosition.y, targetHeight - m_oldArea.top - m_oldArea.height);
+        int scissorRight = std::min(bottomRightPosition.x, m_oldArea.left + m_oldArea.width);
+
+        // If the object outside the window then don't draw anything
+        if (scissorRight < scissorLeft)
+            scissorRight = scissorLeft;
+        if (scissorBottom < scissorTop)
+            scissorTop = scissorBottom;
+
+        const sf::IntRect area{scissorLeft, targetHeight - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop};
+        m_empty = (area.width <= 0) || (area.height <= 0);
+
+        // Set the clipping area
+        if (m_stack)
+        {
+            if (m_stack->areas.size() == m_stack->areas.capacity())
+                priv::RenderBatch::countAllocation();
+
+            m_stack->areas.push_back(area);
+            if (area != m_stack->appliedArea)
+            {
+                applyArea(area);
+                m_stack->appliedArea = area;
+            }
+        }
+        else
+            applyArea(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipping::~Clipping()
+    {
+        if (m_stack)
+        {
+            assert(m_stack->areas.size() > 1);
+            m_stack->areas.pop_back();
+
+            // The scissor box only has to be changed when the previous area differs from the current one
+            if (m_stack->areas.back() != m_stack->appliedArea)
+            {
+                applyArea(m_stack->areas.back());
+                m_stack->appliedArea = m_stack->areas.back();
+            }
+        }
+        else
+            applyArea(m_oldArea);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Clipping::isEmpty() const
+    {
+        return m_empty;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Clipping::isCurrentAreaEmpty(const sf::RenderTarget& target)
+    {
+        if (!m_activeStack || (m_activeStack->target != &target))
+            return false;
+
+        const sf::IntRect& area = m_activeStack->areas.back();
+        return (area.width <= 0) || (area.height <= 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Clipping::cullArea(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size)
+    {
+        if (!m_activeStack || (m_activeStack->target != &target))
+            return false;
+
+        // Find the bounding box of the area in pixels. All corners are needed as the transform could contain a rotation.
+        const sf::Vector2i corners[] = {
+            target.mapCoordsToPixel(states.transform.transformPoint(topLeft)),
+            target.mapCoordsToPixel(states.transform.transformPoint({topLeft.x + size.x, topLeft.y})),
+            target.mapCoordsToPixel(states.transform.transformPoint({topLeft.x, topLeft.y + size.y})),
+            target.mapCoordsToPixel(states.transform.transformPoint(topLeft + size))
+        };
+
+        sf::Vector2i minPos = corners[0];
+        sf::Vector2i maxPos = corners[0];
+        for (const auto& corner : corners)
+        {
+            minPos.x = std::min(minPos.x, corner.x);
+            minPos.y = std::min(minPos.y, corner.y);
+            maxPos.x = std::max(maxPos.x, corner.x);
+            maxPos.y = std::max(maxPos.y, corner.y);
+        }
+
+        // The clipping area is stored in OpenGL coordinates, where the y-axis points upwards
+        const sf::IntRect& area = m_activeStack->areas.back();
+        const int targetHeight = static_cast<int>(target.getSize().y);
+        const int areaTop = targetHeight - area.top - area.height;
+        const int areaBottom = targetHeight - area.top;
+
+        // Areas that touch the clipping area are never culled, even when they have no size
+        if ((maxPos.x < area.left) || (minPos.x > area.left + area.width) || (maxPos.y < areaTop) || (minPos.y > areaBottom))
+        {
+            ++m_activeStack->culledCount;
+            return true;
+        }
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::beginStack(priv::ClippingStack& stack, const sf::RenderTarget& target, const sf::IntRect& area)
+    {
+        stack.target = &target;
+        stack.culledCount = 0;
+        stack.areas.clear();
+        if (stack.areas.capacity() == 0)
+            priv::RenderBatch::countAllocation();
+
+        stack.areas.push_back(area);
+        stack.appliedArea = area;
+
+        stack.previousStack = m_activeStack;
+        m_activeStack = &stack;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::endStack(priv::ClippingStack& stack)
+    {
+        assert(m_activeStack == &stack);
+        assert(stack.areas.size() == 1);
+
+        m_activeStack = stack.previousStack;
+        stack.previousStack = nullptr;
+        stack.target = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::applyArea(const sf::IntRect& area)
+    {
+        // Everything that was batched before this point has to be drawn with the old clipping area
+        priv::RenderBatch::flushActive(m_target);
+
+        glScissor(area.left, area.top, area.width, area.height);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
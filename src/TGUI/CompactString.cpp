@@ -0,0 +1,179 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/CompactString.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            void encodeUtf8(sf::Uint32 codePoint, std::string& output)
+            {
+                // Characters outside the unicode range are stored as the replacement character
+                if ((codePoint > 0x10FFFF) || ((codePoint >= 0xD800) && (codePoint <= 0xDFFF)))
+                    codePoint = 0xFFFD;
+
+                if (codePoint < 0x80)
+                    output.push_back(static_cast<char>(codePoint));
+                else if (codePoint < 0x800)
+                {
+                    output.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                    output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                }
+                else if (codePoint < 0x10000)
+                {
+                    output.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                    output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                }
+                else
+                {
+                    output.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                    output.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                    output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                    output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+                }
+            }
+
+            // Reads the character at the given position and moves the position behind it.
+            // The bytes were written by encodeUtf8, so they don't have to be validated.
+            sf::Uint32 decodeUtf8(const std::string& input, std::size_t& pos)
+            {
+                const sf::Uint32 first = static_cast<unsigned char>(input[pos++]);
+                if (first < 0x80)
+                    return first;
+
+                std::size_t extraBytes;
+                sf::Uint32 codePoint;
+                if (first < 0xE0)
+                {
+                    extraBytes = 1;
+                    codePoint = first & 0x1F;
+                }
+                else if (first < 0xF0)
+                {
+                    extraBytes = 2;
+                    codePoint = first & 0x0F;
+                }
+                else
+                {
+                    extraBytes = 3;
+                    codePoint = first & 0x07;
+                }
+
+                for (std::size_t i = 0; i < extraBytes; ++i)
+                    codePoint = (codePoint << 6) | (static_cast<unsigned char>(input[pos++]) & 0x3F);
+
+                return codePoint;
+            }
+
+            // Compares the first characters of the utf-8 string with the characters of the sf::String
+            bool startsWithCharacters(const std::string& utf8, const sf::String& string)
+            {
+                std::size_t pos = 0;
+                const sf::Uint32* const characters = string.getData();
+                for (std::size_t i = 0; i < string.getSize(); ++i)
+                {
+                    if (decodeUtf8(utf8, pos) != characters[i])
+                        return false;
+                }
+
+                return true;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        CompactString::CompactString(const sf::String& string) :
+            m_length{static_cast<std::uint32_t>(string.getSize())}
+        {
+            m_utf8.reserve(string.getSize());
+
+            const sf::Uint32* const characters = string.getData();
+            for (std::size_t i = 0; i < string.getSize(); ++i)
+                encodeUtf8(characters[i], m_utf8);
+
+            // Strings are usually not changed, so the reserved memory is shrunk when non-ASCII characters caused a reallocation
+            if (m_utf8.capacity() > m_utf8.size() + 16)
+                m_utf8.shrink_to_fit();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String CompactString::toString() const
+        {
+            std::basic_string<sf::Uint32> characters;
+            characters.reserve(m_length);
+
+            std::size_t pos = 0;
+            while (pos < m_utf8.size())
+                characters.push_back(decodeUtf8(m_utf8, pos));
+
+            return sf::String{characters};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool CompactString::startsWith(const sf::String& prefix) const
+        {
+            if (prefix.getSize() > m_length)
+                return false;
+
+            return startsWithCharacters(m_utf8, prefix);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t CompactString::getMemoryUsage() const
+        {
+            // Nothing was allocated when the bytes are stored inside the object itself (small string optimization)
+            const char* const data = m_utf8.data();
+            const char* const objectBegin = reinterpret_cast<const char*>(this);
+            if ((data >= objectBegin) && (data < objectBegin + sizeof(CompactString)))
+                return sizeof(CompactString);
+            else
+                return sizeof(CompactString) + m_utf8.capacity() + 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool operator==(const CompactString& left, const sf::String& right)
+        {
+            if (left.m_length != right.getSize())
+                return false;
+
+            return startsWithCharacters(left.m_utf8, right);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
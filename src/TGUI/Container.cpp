@@ -25,15 +25,38 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
 
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/OpenGL.hpp>
+
 #include <cassert>
+#include <cmath>
 #include <fstream>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    void setTargetActive(sf::RenderTarget& target)
+    {
+    #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
+        if (dynamic_cast<sf::RenderWindow*>(&target))
+            dynamic_cast<sf::RenderWindow*>(&target)->setActive(true);
+        else if (dynamic_cast<sf::RenderTexture*>(&target))
+            dynamic_cast<sf::RenderTexture*>(&target)->setActive(true);
+    #else
+        target.setActive(true);
+    #endif
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     extern TGUI_API bool TGUI_TabKeyUsageEnabled;
@@ -49,11 +72,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget              {other},
+        m_renderCacheEnabled{other.m_renderCacheEnabled}
     {
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
-            add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
+            add(other.m_widgets[i]->clone(), other.m_widgetNames[i].toString());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,7 +88,12 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_renderCacheEnabled  {std::move(other.m_renderCacheEnabled)},
+        m_renderCacheValid    {std::move(other.m_renderCacheValid)},
+        m_renderCache         {std::move(other.m_renderCache)},
+        m_renderCacheOffset   {std::move(other.m_renderCacheOffset)},
+        m_renderCacheScale    {std::move(other.m_renderCacheScale)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
@@ -94,6 +123,8 @@ namespace tgui
 
             m_widgetBelowMouse = nullptr;
             m_focusedWidget = 0;
+            m_renderCacheEnabled = right.m_renderCacheEnabled;
+            m_renderCacheValid = false;
 
             // Remove all the old widgets
             removeAllWidgets();
@@ -102,7 +133,7 @@ namespace tgui
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
                 // Don't allow the 'add' function of a derived class to be called, since its members are not copied yet
-                Container::add(right.m_widgets[i]->clone(), right.m_widgetNames[i]);
+                Container::add(right.m_widgets[i]->clone(), right.m_widgetNames[i].toString());
             }
         }
 
@@ -122,6 +153,11 @@ namespace tgui
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_renderCacheEnabled   = std::move(right.m_renderCacheEnabled);
+            m_renderCacheValid     = std::move(right.m_renderCacheValid);
+            m_renderCache          = std::move(right.m_renderCache);
+            m_renderCacheOffset    = std::move(right.m_renderCacheOffset);
+            m_renderCacheScale     = std::move(right.m_renderCacheScale);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
@@ -147,6 +183,9 @@ namespace tgui
 
         if (m_opacityCached < 1)
             widgetPtr->setInheritedOpacity(m_opacityCached);
+
+        m_renderCacheValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +213,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<sf::String> Container::getWidgetNames() const
+    {
+        std::vector<sf::String> names;
+        names.reserve(m_widgetNames.size());
+        for (const auto& name : m_widgetNames)
+            names.push_back(name.toString());
+
+        return names;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::remove(const Widget::Ptr& widget)
     {
         // Loop through every widget
@@ -200,6 +251,9 @@ namespace tgui
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+
+                m_renderCacheValid = false;
+                invalidate();
                 return true;
             }
         }
@@ -220,6 +274,9 @@ namespace tgui
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = 0;
+
+        m_renderCacheValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -230,7 +287,7 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
-                m_widgetNames[i] = name;
+                m_widgetNames[i] = sf::String{name};
                 return true;
             }
         }
@@ -245,7 +302,7 @@ namespace tgui
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i] == widget)
-                return m_widgetNames[i];
+                return m_widgetNames[i].toString();
         }
 
         return "";
@@ -472,6 +529,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        m_renderCacheEnabled = enabled;
+        m_renderCacheValid = false;
+
+        if (!enabled)
+            m_renderCache = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheEnabled() const
+    {
+        return m_renderCacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheValid() const
+    {
+        return m_renderCacheEnabled && m_renderCacheValid;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::moveWidgetToFront(const Widget::Ptr& widget)
     {
         // Loop through all widgets
@@ -494,6 +576,8 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
 
+                m_renderCacheValid = false;
+                invalidate();
                 break;
             }
         }
@@ -511,7 +595,7 @@ namespace tgui
             {
                 // Copy the widget
                 const Widget::Ptr obj = m_widgets[i];
-                const std::string name = m_widgetNames[i];
+                const priv::CompactString name = m_widgetNames[i];
                 m_widgets.insert(m_widgets.begin(), obj);
                 m_widgetNames.insert(m_widgetNames.begin(), name);
 
@@ -525,6 +609,8 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i + 1);
                 m_widgetNames.erase(m_widgetNames.begin() + i + 1);
 
+                m_renderCacheValid = false;
+                invalidate();
                 break;
             }
         }
@@ -618,6 +704,8 @@ namespace tgui
     {
         if (m_mouseHover)
         {
+            m_renderCacheValid = false;
+
             mouseLeftWidget();
 
             if (m_widgetBelowMouse)
@@ -704,6 +792,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Container::getTimeUntilNextUpdate() const
+    {
+        sf::Time timeUntilNextUpdate = Widget::getTimeUntilNextUpdate();
+        for (const auto& widget : m_widgets)
+        {
+            // Only visible widgets are updated
+            if (widget->isVisible())
+                timeUntilNextUpdate = std::min(timeUntilNextUpdate, widget->getTimeUntilNextUpdate());
+        }
+
+        return timeUntilNextUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -1045,12 +1148,136 @@ namespace tgui
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        // Nothing has to be drawn when everything would be clipped away
+        if (Clipping::isCurrentAreaEmpty(*target))
+            return;
+
+        priv::RenderBatch* batch = priv::RenderBatch::getActive(*target);
+
         // Draw all widgets when they are visible
         for (const auto& widget : m_widgets)
         {
-            if (widget->isVisible())
+            if (!widget->isVisible())
+                continue;
+
+            // Widgets that lie completely outside the clipping area don't have to be drawn
+            if (widget->m_allowCulling && Clipping::cullArea(*target, states, widget->getPosition() + widget->getWidgetOffset(), widget->getFullSize()))
+                continue;
+
+            // The geometry of the widget keeps its place in the vertex buffer of the batch when it doesn't change
+            const priv::RenderBatch::OwnerScope ownerScope{batch, widget.get()};
+
+            // Widgets that might draw directly on the target can't be batched without changing the draw order
+            if (batch && !widget->m_batchedDrawing)
+            {
+                batch->setPaused(true);
                 widget->draw(*target, states);
+                batch->setPaused(false);
+            }
+            else
+                widget->draw(*target, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawCachedWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states, sf::Vector2f contentSize, sf::Vector2f contentOffset) const
+    {
+        // The texture has the size of the content in pixels, otherwise the cached widgets would look blurry when the view is scaled
+        const sf::View& targetView = target->getView();
+        const sf::IntRect targetViewport = target->getViewport(targetView);
+        const sf::Vector2f pixelScale{targetViewport.width / targetView.getSize().x, targetViewport.height / targetView.getSize().y};
+        const sf::Vector2u cacheSize{static_cast<unsigned int>(std::ceil(contentSize.x * pixelScale.x)),
+                                     static_cast<unsigned int>(std::ceil(contentSize.y * pixelScale.y))};
+        if (!m_renderCacheEnabled || (cacheSize.x == 0) || (cacheSize.y == 0))
+        {
+            sf::RenderStates childStates = states;
+            childStates.transform.translate(contentOffset);
+            drawWidgetContainer(target, childStates);
+            return;
         }
+
+        if (!m_renderCache || (m_renderCache->getSize() != cacheSize))
+        {
+            m_renderCache = make_unique<sf::RenderTexture>();
+            if (!m_renderCache->create(cacheSize.x, cacheSize.y))
+            {
+                m_renderCache = nullptr;
+
+                sf::RenderStates childStates = states;
+                childStates.transform.translate(contentOffset);
+                drawWidgetContainer(target, childStates);
+                return;
+            }
+
+            m_renderCacheValid = false;
+        }
+
+        // Size of the texture in the coordinates of the view, which is slightly larger than the content when it was rounded up
+        const sf::Vector2f size{cacheSize.x / pixelScale.x, cacheSize.y / pixelScale.y};
+        if (!m_renderCacheValid || (m_renderCacheOffset != contentOffset) || (m_renderCacheScale != pixelScale))
+        {
+            // The widgets are drawn to the texture with their own clipping and batching, just like the gui does it.
+            // The geometry that the gui already queued is drawn first, as that would activate the context of the target again.
+            priv::RenderBatch::flushActive(*target);
+            m_renderCache->setActive(true);
+            m_renderCache->setView(sf::View{{0, 0, size.x, size.y}});
+
+            GLint oldScissor[4];
+            const GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
+            if (clippingEnabled)
+                glGetIntegerv(GL_SCISSOR_BOX, oldScissor);
+            else
+                glEnable(GL_SCISSOR_TEST);
+
+            glScissor(0, 0, static_cast<GLint>(cacheSize.x), static_cast<GLint>(cacheSize.y));
+
+            m_renderCache->clear(sf::Color::Transparent);
+
+            sf::RenderStates cacheStates;
+            cacheStates.transform.translate(contentOffset);
+
+            priv::ClippingStack clippingStack;
+            priv::RenderBatch renderBatch;
+            renderBatch.begin(*m_renderCache);
+            Clipping::beginStack(clippingStack, *m_renderCache, {0, 0, static_cast<int>(cacheSize.x), static_cast<int>(cacheSize.y)});
+            drawWidgetContainer(m_renderCache.get(), cacheStates);
+            Clipping::endStack(clippingStack);
+            renderBatch.end();
+
+            // Reset clipping to its original state
+            if (clippingEnabled)
+                glScissor(oldScissor[0], oldScissor[1], oldScissor[2], oldScissor[3]);
+            else
+                glDisable(GL_SCISSOR_TEST);
+
+            m_renderCache->display();
+            m_renderCacheOffset = contentOffset;
+            m_renderCacheScale = pixelScale;
+            m_renderCacheValid = true;
+
+            // Continue drawing on the original target
+            setTargetActive(*target);
+        }
+
+        // The colors in the texture are already multiplied with their alpha value, they shouldn't be multiplied again
+        sf::RenderStates cacheStates = states;
+        cacheStates.texture = &m_renderCache->getTexture();
+        cacheStates.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+        const sf::Vector2f textureSize{static_cast<float>(cacheSize.x), static_cast<float>(cacheSize.y)};
+        const sf::Vertex vertices[] = {
+            {{0, 0}, {0, 0}},
+            {{0, size.y}, {0, textureSize.y}},
+            {{size.x, 0}, {textureSize.x, 0}},
+            {{size.x, size.y}, {textureSize.x, textureSize.y}}
+        };
+
+        priv::RenderBatch* batch = priv::RenderBatch::getActive(*target);
+        if (batch)
+            batch->addTriangleStrip(vertices, 4, cacheStates);
+        else
+            target->draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, cacheStates);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1059,6 +1286,7 @@ namespace tgui
     GuiContainer::GuiContainer()
     {
         m_type = "GuiContainer";
+        m_batchedDrawing = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
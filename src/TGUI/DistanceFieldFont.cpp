@@ -0,0 +1,348 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/FontCache.hpp>
+#include <TGUI/Global.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            struct FontFields
+            {
+                std::unique_ptr<DistanceFieldFont> regular;
+                std::unique_ptr<DistanceFieldFont> bold;
+            };
+
+            FontCache<const sf::Font*, FontFields> fontFields;
+
+            bool enabled = false;
+            bool shaderLoaded = false;
+            std::unique_ptr<sf::Shader> shader;
+
+            // Turns the distance in the alpha channel into the coverage of the pixel. The width of the transition is
+            // based on how fast the distance changes between neighbouring pixels, which depends on the scale of the text.
+            const char fragmentShader[] =
+                "uniform sampler2D texture;\n"
+                "void main()\n"
+                "{\n"
+                "    float distance = texture2D(texture, gl_TexCoord[0].xy).a;\n"
+                "    float smoothing = 0.7 * fwidth(distance);\n"
+                "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);\n"
+                "    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);\n"
+                "}\n";
+
+            const float infinity = 1e20f;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Squared distance transform in one dimension (Felzenszwalb and Huttenlocher), in place with a given stride
+            void transformLine(float* values, std::size_t count, std::size_t stride,
+                               std::vector<float>& f, std::vector<float>& z, std::vector<std::size_t>& v)
+            {
+                for (std::size_t q = 0; q < count; ++q)
+                    f[q] = values[q * stride];
+
+                std::size_t k = 0;
+                v[0] = 0;
+                z[0] = -infinity;
+                z[1] = infinity;
+                for (std::size_t q = 1; q < count; ++q)
+                {
+                    const float fq = f[q] + static_cast<float>(q * q);
+                    float s = (fq - (f[v[k]] + static_cast<float>(v[k] * v[k]))) / (2.f * static_cast<float>(q - v[k]));
+                    while (s <= z[k])
+                    {
+                        --k;
+                        s = (fq - (f[v[k]] + static_cast<float>(v[k] * v[k]))) / (2.f * static_cast<float>(q - v[k]));
+                    }
+
+                    ++k;
+                    v[k] = q;
+                    z[k] = s;
+                    z[k + 1] = infinity;
+                }
+
+                k = 0;
+                for (std::size_t q = 0; q < count; ++q)
+                {
+                    while (z[k + 1] < static_cast<float>(q))
+                        ++k;
+
+                    const float distance = static_cast<float>(q) - static_cast<float>(v[k]);
+                    values[q * stride] = (distance * distance) + f[v[k]];
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Replaces every value by the squared distance to the nearest pixel with a value of 0
+            void transformImage(std::vector<float>& values, std::size_t width, std::size_t height)
+            {
+                const std::size_t maxSize = std::max(width, height);
+                std::vector<float> f(maxSize);
+                std::vector<float> z(maxSize + 1);
+                std::vector<std::size_t> v(maxSize);
+
+                for (std::size_t x = 0; x < width; ++x)
+                    transformLine(&values[x], height, width, f, z, v);
+
+                for (std::size_t y = 0; y < height; ++y)
+                    transformLine(&values[y * width], width, 1, f, z, v);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void DistanceFieldFont::setEnabled(bool enable)
+        {
+            enabled = enable && (getShader() != nullptr);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool DistanceFieldFont::isEnabled()
+        {
+            return enabled;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        DistanceFieldFont& DistanceFieldFont::get(const std::shared_ptr<sf::Font>& font, bool bold)
+        {
+            FontFields& cachedFields = fontFields.get(font.get(), font);
+            auto& fields = bold ? cachedFields.bold : cachedFields.regular;
+            if (!fields)
+                fields = make_unique<DistanceFieldFont>(*font, bold);
+
+            return *fields;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const sf::Shader* DistanceFieldFont::getShader()
+        {
+            if (!shaderLoaded)
+            {
+                shaderLoaded = true;
+                if (sf::Shader::isAvailable())
+                {
+                    shader = make_unique<sf::Shader>();
+                    if (shader->loadFromMemory(fragmentShader, sf::Shader::Fragment))
+                    {
+                    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                        shader->setUniform("texture", sf::Shader::CurrentTexture);
+                    #else
+                        shader->setParameter("texture", sf::Shader::CurrentTexture);
+                    #endif
+                    }
+                    else
+                        shader = nullptr;
+                }
+            }
+
+            return shader.get();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        DistanceFieldFont::DistanceFieldFont(const sf::Font& font, bool bold) :
+            m_font{font},
+            m_bold{bold}
+        {
+            // The opaque pixels for the underlines are in the top left corner
+            m_rowLeft = 4;
+            m_rowHeight = 4;
+            m_usedHeight = 4;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const DistanceFieldFont::Glyph& DistanceFieldFont::getGlyph(sf::Uint32 codePoint)
+        {
+            const auto it = m_glyphs.find(codePoint);
+            if (it != m_glyphs.end())
+                return it->second;
+
+            const sf::Glyph& fontGlyph = m_font.getGlyph(codePoint, BaseCharacterSize, m_bold);
+
+            Glyph& glyph = m_glyphs[codePoint];
+            glyph.advance = static_cast<float>(fontGlyph.advance);
+            glyph.bounds = fontGlyph.bounds;
+
+            // Reserve a place in the atlas, with an empty pixel between the glyphs
+            if ((fontGlyph.textureRect.width > 0) && (fontGlyph.textureRect.height > 0))
+            {
+                const unsigned int width = static_cast<unsigned int>(fontGlyph.textureRect.width) + 2 * Spread;
+                const unsigned int height = static_cast<unsigned int>(fontGlyph.textureRect.height) + 2 * Spread;
+                if (m_rowLeft + width + 1 > AtlasWidth)
+                {
+                    m_rowTop += m_rowHeight + 1;
+                    m_rowLeft = 0;
+                    m_rowHeight = 0;
+                }
+
+                glyph.textureRect = {static_cast<int>(m_rowLeft + 1), static_cast<int>(m_rowTop + 1), static_cast<int>(width), static_cast<int>(height)};
+
+                m_rowLeft += width + 1;
+                m_rowHeight = std::max(m_rowHeight, height + 1);
+                m_usedHeight = std::max(m_usedHeight, m_rowTop + m_rowHeight + 1);
+                m_pendingGlyphs.push_back(codePoint);
+            }
+
+            return glyph;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float DistanceFieldFont::getKerning(sf::Uint32 first, sf::Uint32 second) const
+        {
+            return static_cast<float>(m_font.getKerning(first, second, BaseCharacterSize));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const sf::Texture& DistanceFieldFont::getTexture()
+        {
+            if (!m_textureCreated || !m_pendingGlyphs.empty())
+                createPendingFields();
+
+            return m_texture;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t DistanceFieldFont::getGlyphCount() const
+        {
+            return m_glyphs.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void DistanceFieldFont::createPendingFields()
+        {
+            // Make the atlas larger when the new glyphs don't fit
+            const unsigned int oldHeight = m_textureCreated ? m_texture.getSize().y : 0;
+            if (oldHeight < m_usedHeight)
+            {
+                unsigned int newHeight = std::max(oldHeight, 256u);
+                while (newHeight < m_usedHeight)
+                    newHeight *= 2;
+
+                newHeight = std::min(newHeight, sf::Texture::getMaximumSize());
+
+                sf::Image image;
+                image.create(AtlasWidth, newHeight, sf::Color{255, 255, 255, 0});
+                if (m_textureCreated)
+                    image.copy(m_texture.copyToImage(), 0, 0);
+                else
+                {
+                    for (unsigned int y = 0; y < 4; ++y)
+                    {
+                        for (unsigned int x = 0; x < 4; ++x)
+                            image.setPixel(x, y, sf::Color::White);
+                    }
+                }
+
+                m_texture.loadFromImage(image);
+                m_texture.setSmooth(true);
+                m_textureCreated = true;
+            }
+
+            if (m_pendingGlyphs.empty())
+                return;
+
+            // The glyphs are rendered at the base size by sf::Font, read them back once for all new glyphs
+            const sf::Image page = m_font.getTexture(BaseCharacterSize).copyToImage();
+            const sf::Uint8* const pagePixels = page.getPixelsPtr();
+            const unsigned int pageWidth = page.getSize().x;
+
+            std::vector<float> outside;
+            std::vector<float> inside;
+            std::vector<sf::Uint8> pixels;
+            for (const sf::Uint32 codePoint : m_pendingGlyphs)
+            {
+                const Glyph& glyph = m_glyphs[codePoint];
+                if (static_cast<unsigned int>(glyph.textureRect.top + glyph.textureRect.height) > m_texture.getSize().y)
+                    continue; // The atlas can't become any larger, the glyph won't be visible
+
+                const sf::IntRect source = m_font.getGlyph(codePoint, BaseCharacterSize, m_bold).textureRect;
+                const std::size_t width = static_cast<std::size_t>(glyph.textureRect.width);
+                const std::size_t height = static_cast<std::size_t>(glyph.textureRect.height);
+
+                // Find the distance to the nearest pixel inside the glyph and to the nearest pixel outside the glyph
+                outside.assign(width * height, 0);
+                inside.assign(width * height, 0);
+                for (std::size_t y = Spread; y < height - Spread; ++y)
+                {
+                    for (std::size_t x = Spread; x < width - Spread; ++x)
+                    {
+                        const std::size_t pageX = static_cast<std::size_t>(source.left) + x - Spread;
+                        const std::size_t pageY = static_cast<std::size_t>(source.top) + y - Spread;
+                        if (pagePixels[4 * ((pageY * pageWidth) + pageX) + 3] >= 128)
+                            inside[(y * width) + x] = infinity;
+                    }
+                }
+
+                for (std::size_t i = 0; i < width * height; ++i)
+                    outside[i] = (inside[i] == 0) ? infinity : 0;
+
+                transformImage(outside, width, height);
+                transformImage(inside, width, height);
+
+                // A value of 0.5 lies on the outline, the values decrease outside the glyph and increase inside it
+                pixels.resize(4 * width * height);
+                for (std::size_t i = 0; i < width * height; ++i)
+                {
+                    const float distance = std::sqrt(outside[i]) - std::sqrt(inside[i]);
+                    const float value = std::max(0.f, std::min(1.f, 0.5f - (distance / (2.f * Spread))));
+
+                    pixels[4 * i] = 255;
+                    pixels[4 * i + 1] = 255;
+                    pixels[4 * i + 2] = 255;
+                    pixels[4 * i + 3] = static_cast<sf::Uint8>(std::round(value * 255));
+                }
+
+                m_texture.update(pixels.data(), static_cast<unsigned int>(width), static_cast<unsigned int>(height),
+                                 static_cast<unsigned int>(glyph.textureRect.left), static_cast<unsigned int>(glyph.textureRect.top));
+            }
+
+            m_pendingGlyphs.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
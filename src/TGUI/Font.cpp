@@ -25,8 +25,10 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/GlyphMetrics.hpp>
 
 #include <cassert>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -158,6 +160,64 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font::GlyphPreloadStatistics Font::preloadGlyphs(const std::vector<GlyphRange>& ranges, const std::vector<unsigned int>& characterSizes, bool bold) const
+    {
+        GlyphPreloadStatistics statistics;
+        if (!m_font)
+            return statistics;
+
+        // The font is shared with the metrics, which may be used by text that is being wrapped on other threads
+        std::mutex& fontMutex = priv::GlyphMetrics::getFontMutex();
+
+        for (const unsigned int characterSize : characterSizes)
+        {
+            sf::Vector2u oldTextureSize;
+            {
+                std::lock_guard<std::mutex> lock(fontMutex);
+                oldTextureSize = m_font->getTexture(characterSize).getSize();
+            }
+
+            // Also fill the metrics that are used to measure the text, so that the first word-wrap doesn't need the font
+            priv::GlyphMetrics& metrics = priv::GlyphMetrics::get(m_font, characterSize, bold);
+            for (const auto& range : ranges)
+            {
+                if (range.first > range.last)
+                    continue;
+
+                sf::Uint32 codePoint = range.first;
+                while (true)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(fontMutex);
+                        m_font->getGlyph(codePoint, characterSize, bold);
+                    }
+
+                    metrics.getAdvance(codePoint);
+                    ++statistics.requestedGlyphCount;
+
+                    // The last code point could be the highest value that fits in the type
+                    if (codePoint == range.last)
+                        break;
+
+                    ++codePoint;
+                }
+            }
+
+            sf::Vector2u newTextureSize;
+            {
+                std::lock_guard<std::mutex> lock(fontMutex);
+                newTextureSize = m_font->getTexture(characterSize).getSize();
+            }
+
+            statistics.textureMemory += 4 * ((static_cast<std::size_t>(newTextureSize.x) * newTextureSize.y)
+                                             - (static_cast<std::size_t>(oldTextureSize.x) * oldTextureSize.y));
+        }
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
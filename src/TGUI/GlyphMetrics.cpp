@@ -0,0 +1,307 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/FontCache.hpp>
+#include <TGUI/Global.hpp>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            FontCache<const sf::Font*, std::unordered_map<unsigned int, std::unique_ptr<GlyphMetrics>>> fontMetricsCaches;
+
+            // Protects the caches above as well as every call to sf::Font
+            std::mutex fontMutex;
+
+            // Set while threads are measuring preloaded text, nothing is added to the hash maps in the meantime
+            std::atomic<bool> readOnlyMetrics{false};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphMetrics& GlyphMetrics::get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold)
+        {
+            std::lock_guard<std::mutex> lock(fontMutex);
+
+            auto& fontMetrics = fontMetricsCaches.get(font.get(), font);
+
+            // Text drawn from distance fields has slightly different metrics, so both kinds are cached separately
+            const bool distanceField = DistanceFieldFont::isEnabled();
+            auto& metrics = fontMetrics[(characterSize << 2) | (distanceField ? 2 : 0) | (bold ? 1 : 0)];
+            if (!metrics)
+            {
+                if (distanceField)
+                    metrics = make_unique<GlyphMetrics>(*font, characterSize, bold, &DistanceFieldFont::get(font, bold));
+                else
+                    metrics = make_unique<GlyphMetrics>(*font, characterSize, bold);
+            }
+
+            return *metrics;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphMetrics::GlyphMetrics(const sf::Font& font, unsigned int characterSize, bool bold, DistanceFieldFont* distanceField) :
+            m_font         {font},
+            m_characterSize{characterSize},
+            m_bold         {bold},
+            m_distanceField{distanceField}
+        {
+            for (unsigned int i = 0; i < 2; ++i)
+            {
+                m_asciiAdvancesLoaded[i].store(0, std::memory_order_relaxed);
+                m_asciiKerningRowsLoaded[i].store(0, std::memory_order_relaxed);
+            }
+
+            m_lineSpacing = static_cast<float>(font.getLineSpacing(characterSize));
+
+            // Height of the first line (char size = everything above baseline, height + top = part below baseline)
+            if (m_distanceField)
+            {
+                m_distanceFieldScale = static_cast<float>(characterSize) / DistanceFieldFont::BaseCharacterSize;
+
+                const sf::FloatRect bounds = m_distanceField->getGlyph('g').bounds;
+                m_extraVerticalSpace = characterSize + (bounds.height + bounds.top) * m_distanceFieldScale - m_lineSpacing;
+            }
+            else
+            {
+                const sf::FloatRect bounds = font.getGlyph('g', characterSize, bold).bounds;
+                m_extraVerticalSpace = characterSize + bounds.height + bounds.top - m_lineSpacing;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::getLineWidth(const sf::Uint32* characters, std::size_t count, sf::Uint32 prevChar)
+        {
+            // Find out which characters the text contains. A character outside the ASCII range sets a bit above the lowest 7 bits.
+            sf::Uint32 allBits = prevChar;
+            std::uint64_t usedCharacters[2] = {0, 0};
+            usedCharacters[(prevChar / 64) & 1] |= getAsciiBit(prevChar);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                allBits |= characters[i];
+                usedCharacters[(characters[i] / 64) & 1] |= getAsciiBit(characters[i]);
+            }
+
+            float width = 0;
+            if (allBits < AsciiCount)
+            {
+                const std::uint64_t missingCharacters = (usedCharacters[0] & ~m_asciiAdvancesLoaded[0].load(std::memory_order_acquire))
+                                                      | (usedCharacters[1] & ~m_asciiAdvancesLoaded[1].load(std::memory_order_acquire))
+                                                      | (usedCharacters[0] & ~m_asciiKerningRowsLoaded[0].load(std::memory_order_acquire))
+                                                      | (usedCharacters[1] & ~m_asciiKerningRowsLoaded[1].load(std::memory_order_acquire));
+                if (missingCharacters)
+                    loadAsciiTables(usedCharacters);
+
+                // All entries are available, the width is the sum of the table values
+                const float* const kerning = m_asciiKerning.data();
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const sf::Uint32 curChar = characters[i];
+                    width += kerning[(prevChar * AsciiCount) + curChar] + m_asciiAdvances[curChar];
+                    prevChar = curChar;
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const sf::Uint32 curChar = characters[i];
+                    width += getKerning(prevChar, curChar) + getAdvance(curChar);
+                    prevChar = curChar;
+                }
+            }
+
+            return width;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphMetrics::preload(const sf::Uint32* characters, std::size_t count)
+        {
+            // The word wrapper measures every character after the previous one and at the start of a line
+            sf::Uint32 prevChar = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const sf::Uint32 curChar = characters[i];
+                getAdvance(curChar);
+                getKerning(prevChar, curChar);
+                getKerning(0, curChar);
+
+                prevChar = curChar;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphMetrics::setReadOnly(bool readOnly)
+        {
+            readOnlyMetrics.store(readOnly, std::memory_order_release);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::mutex& GlyphMetrics::getFontMutex()
+        {
+            return fontMutex;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphMetrics::loadAsciiAdvance(sf::Uint32 codePoint)
+        {
+            std::lock_guard<std::mutex> lock(fontMutex);
+
+            // Another thread may have loaded the entry while we were waiting
+            const std::uint64_t loaded = m_asciiAdvancesLoaded[codePoint / 64].load(std::memory_order_relaxed);
+            if (loaded & getAsciiBit(codePoint))
+                return;
+
+            if (codePoint == '\t')
+                m_asciiAdvances[codePoint] = loadAdvance(' ') * 4;
+            else
+                m_asciiAdvances[codePoint] = loadAdvance(codePoint);
+
+            m_asciiAdvancesLoaded[codePoint / 64].store(loaded | getAsciiBit(codePoint), std::memory_order_release);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphMetrics::loadAsciiKerningRow(sf::Uint32 first)
+        {
+            std::lock_guard<std::mutex> lock(fontMutex);
+
+            const std::uint64_t loaded = m_asciiKerningRowsLoaded[first / 64].load(std::memory_order_relaxed);
+            if (loaded & getAsciiBit(first))
+                return;
+
+            if (m_asciiKerning.empty())
+                m_asciiKerning.resize(AsciiCount * AsciiCount);
+
+            for (sf::Uint32 second = 0; second < AsciiCount; ++second)
+                m_asciiKerning[(first * AsciiCount) + second] = loadKerning(first, second);
+
+            m_asciiKerningRowsLoaded[first / 64].store(loaded | getAsciiBit(first), std::memory_order_release);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphMetrics::loadAsciiTables(const std::uint64_t (&characters)[2])
+        {
+            for (sf::Uint32 codePoint = 0; codePoint < AsciiCount; ++codePoint)
+            {
+                if (!(characters[codePoint / 64] & getAsciiBit(codePoint)))
+                    continue;
+
+                // These functions only lock the mutex when the entries aren't loaded yet
+                getAdvance(codePoint);
+                getKerning(codePoint, 0);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::loadAdvance(sf::Uint32 codePoint)
+        {
+            if (m_distanceField)
+                return m_distanceField->getGlyph(codePoint).advance * m_distanceFieldScale;
+            else
+                return static_cast<float>(m_font.getGlyph(codePoint, m_characterSize, m_bold).advance);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::loadKerning(sf::Uint32 first, sf::Uint32 second)
+        {
+            if (m_distanceField)
+                return m_distanceField->getKerning(first, second) * m_distanceFieldScale;
+            else
+                return static_cast<float>(m_font.getKerning(first, second, m_characterSize));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::getAdvanceSlow(sf::Uint32 codePoint)
+        {
+            if (readOnlyMetrics.load(std::memory_order_acquire))
+            {
+                const auto it = m_advances.find(codePoint);
+                if (it != m_advances.end())
+                    return it->second;
+
+                std::lock_guard<std::mutex> lock(fontMutex);
+                return loadAdvance(codePoint);
+            }
+
+            std::lock_guard<std::mutex> lock(fontMutex);
+
+            const auto it = m_advances.find(codePoint);
+            if (it != m_advances.end())
+                return it->second;
+
+            const float advance = loadAdvance(codePoint);
+            m_advances[codePoint] = advance;
+            return advance;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetrics::getKerningSlow(sf::Uint32 first, sf::Uint32 second)
+        {
+            const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | second;
+            if (readOnlyMetrics.load(std::memory_order_acquire))
+            {
+                const auto it = m_kerning.find(key);
+                if (it != m_kerning.end())
+                    return it->second;
+
+                std::lock_guard<std::mutex> lock(fontMutex);
+                return loadKerning(first, second);
+            }
+
+            std::lock_guard<std::mutex> lock(fontMutex);
+
+            const auto it = m_kerning.find(key);
+            if (it != m_kerning.end())
+                return it->second;
+
+            const float kerning = loadKerning(first, second);
+            m_kerning[key] = kerning;
+            return kerning;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
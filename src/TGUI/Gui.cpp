@@ -26,11 +26,13 @@
 #include <TGUI/DefaultFont.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/TextRelayoutPass.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/OpenGL.hpp>
 
 #include <cassert>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,6 +49,7 @@ namespace tgui
     #endif
     {
         m_container->m_focused = true;
+        m_container->m_gui = this;
 
         auto defaultFont = std::make_shared<sf::Font>();
         if (defaultFont->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
@@ -61,6 +64,7 @@ namespace tgui
         m_accessToWindow(true)
     {
         m_container->m_focused = true;
+        m_container->m_gui = this;
 
         Clipboard::setWindowHandle(window.getSystemHandle());
 
@@ -83,6 +87,7 @@ namespace tgui
     #endif
     {
         m_container->m_focused = true;
+        m_container->m_gui = this;
 
         setView(target.getDefaultView());
 
@@ -102,6 +107,7 @@ namespace tgui
         Clipboard::setWindowHandle(window.getSystemHandle());
 
         setView(window.getDefaultView());
+        invalidate();
     }
 #endif
 
@@ -116,6 +122,7 @@ namespace tgui
         m_target = &target;
 
         setView(target.getDefaultView());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,11 +140,16 @@ namespace tgui
         {
             m_view = view;
 
+            // Texts that have to be wrapped again due to the new size are all wrapped together once the layouts are updated
+            TextRelayoutPass::Scope relayoutPass;
+
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
             for (auto& layout : m_container->m_boundSizeLayouts)
                 layout->recalculateValue();
+
+            invalidate();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -225,10 +237,12 @@ namespace tgui
         else if (event.type == sf::Event::LostFocus)
         {
             m_container->m_focused = false;
+            invalidate();
         }
         else if (event.type == sf::Event::GainedFocus)
         {
             m_container->m_focused = true;
+            invalidate();
         #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
             if (m_accessToWindow)
                 Clipboard::setWindowHandle(static_cast<sf::RenderWindow*>(m_target)->getSystemHandle());
@@ -257,10 +271,7 @@ namespace tgui
 #endif
 
         // Update the time
-        if (m_container->m_focused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+        updateTime();
 
         // Check if clipping is enabled
         const GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
@@ -274,16 +285,27 @@ namespace tgui
         else // Clipping was disabled
         {
             // Enable clipping
+            scissor[0] = 0;
+            scissor[1] = 0;
+            scissor[2] = static_cast<GLint>(m_target->getSize().x);
+            scissor[3] = static_cast<GLint>(m_target->getSize().y);
+
             glEnable(GL_SCISSOR_TEST);
-            glScissor(0, 0, m_target->getSize().x, m_target->getSize().y);
+            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
         }
 
         // Change the view
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
 
-        // Draw the widgets
+        // Draw the widgets. The clipping areas are tracked on the stack so that OpenGL never has to be queried while drawing.
+        m_renderBatch.begin(*m_target);
+        Clipping::beginStack(m_clippingStack, *m_target, {scissor[0], scissor[1], scissor[2], scissor[3]});
         m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        Clipping::endStack(m_clippingStack);
+        m_renderBatch.end();
+
+        m_needsRedraw = false;
 
         // Restore the old view
         m_target->setView(oldView);
@@ -297,6 +319,69 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Gui::getDrawCallCount() const
+    {
+        return m_renderBatch.getDrawCallCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getDrawAllocationCount() const
+    {
+        return m_renderBatch.getAllocationCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getCulledWidgetCount() const
+    {
+        return m_clippingStack.culledCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        return m_needsRedraw;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::invalidate()
+    {
+        if (m_needsRedraw)
+            return;
+
+        m_needsRedraw = true;
+        onInvalidated.emit(m_container.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getTimeUntilNextUpdate() const
+    {
+        // The time isn't updated while the window is unfocused
+        if (!m_container->m_focused)
+            return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        sf::Time timeUntilNextUpdate = m_container->getTimeUntilNextUpdate();
+
+        // The tool tip is shown when the mouse stays on the same place for long enough
+        if (m_tooltipPossible)
+            timeUntilNextUpdate = std::min(timeUntilNextUpdate, ToolTip::getTimeToDisplay() - m_tooltipTime);
+
+        // Take the time into account that already passed since the time was last updated
+        const sf::Time timeSinceLastUpdate = m_clock.getElapsedTime();
+        if (timeUntilNextUpdate <= timeSinceLastUpdate)
+            return sf::Time::Zero;
+        else if (timeUntilNextUpdate == sf::microseconds(std::numeric_limits<sf::Int64>::max()))
+            return timeUntilNextUpdate;
+        else
+            return timeUntilNextUpdate - timeSinceLastUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -325,7 +410,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::vector<sf::String>& Gui::getWidgetNames() const
+    std::vector<sf::String> Gui::getWidgetNames() const
     {
         return m_container->getWidgetNames();
     }
@@ -484,6 +569,16 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::updateTime()
+    {
+        if (m_container->m_focused)
+            updateTime(m_clock.restart());
+        else
+            m_clock.restart();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
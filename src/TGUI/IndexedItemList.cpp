@@ -0,0 +1,517 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/IndexedItemList.hpp>
+#include <functional>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            std::size_t hashString(const CompactString& string)
+            {
+                return std::hash<std::string>{}(string.getUtf8());
+            }
+
+            template <typename Function>
+            void forEachTrigram(const std::string& utf8, Function&& function)
+            {
+                for (std::size_t i = 0; i + 2 < utf8.size(); ++i)
+                {
+                    function((static_cast<std::uint32_t>(static_cast<unsigned char>(utf8[i])) << 16)
+                           | (static_cast<std::uint32_t>(static_cast<unsigned char>(utf8[i + 1])) << 8)
+                           | static_cast<std::uint32_t>(static_cast<unsigned char>(utf8[i + 2])));
+                }
+            }
+
+            std::vector<std::uint32_t> getTrigrams(const std::string& utf8)
+            {
+                std::vector<std::uint32_t> trigrams;
+                forEachTrigram(utf8, [&trigrams](std::uint32_t trigram){ trigrams.push_back(trigram); });
+
+                std::sort(trigrams.begin(), trigrams.end());
+                trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+                return trigrams;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        constexpr std::size_t IndexedItemList::NotFound;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::add(const sf::String& text, const sf::String& id, unsigned int height)
+        {
+            m_items.push_back({text, id});
+            m_heights.push_back(height);
+            m_heightTree.pushBack(height);
+
+            if (m_removedCount > 0)
+            {
+                m_removed.push_back(false);
+                m_existingSlots.pushBack(1);
+            }
+
+            if (m_lookupTablesBuilt)
+                insertIntoLookupTables(m_items.size() - 1);
+            if (m_trigramTableBuilt)
+                insertIntoTrigramTable(m_items.size() - 1);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::remove(std::size_t index)
+        {
+            const std::size_t slot = getSlot(index);
+
+            if (m_lookupTablesBuilt)
+                eraseFromLookupTables(slot);
+
+            // The last item can simply be removed as no other item has to move.
+            // Its slot will be reused, so it also has to be removed from the trigram table (which is cheap for the last slot).
+            if (slot + 1 == m_items.size())
+            {
+                if (m_trigramTableBuilt)
+                    eraseFromTrigramTable(slot);
+
+                m_items.pop_back();
+                m_heights.pop_back();
+                m_heightTree.truncate(m_items.size());
+                if (m_removedCount > 0)
+                {
+                    m_removed.pop_back();
+                    m_existingSlots.truncate(m_items.size());
+                }
+                return;
+            }
+
+            // Start keeping track of which items are removed
+            if (m_removedCount == 0)
+            {
+                m_removed.assign(m_items.size(), false);
+                m_existingSlots = FenwickTree<std::size_t>(std::vector<std::size_t>(m_items.size(), 1));
+            }
+
+            m_removed[slot] = true;
+            m_existingSlots.set(slot, 0);
+            m_heightTree.set(slot, 0);
+            m_heights[slot] = 0;
+            m_removedCount++;
+
+            // Free the memory of the removed item immediately, the slot itself is reused when the list is compacted
+            m_items[slot] = {};
+
+            if (m_removedCount * 2 > m_items.size())
+                compact();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::setText(std::size_t index, const sf::String& text)
+        {
+            const std::size_t slot = getSlot(index);
+
+            if (m_lookupTablesBuilt)
+                eraseFromLookupTables(slot);
+            if (m_trigramTableBuilt)
+                eraseFromTrigramTable(slot);
+
+            m_items[slot].text = text;
+
+            if (m_lookupTablesBuilt)
+                insertIntoLookupTables(slot);
+            if (m_trigramTableBuilt)
+                insertIntoTrigramTable(slot);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::setHeight(std::size_t index, unsigned int height)
+        {
+            const std::size_t slot = getSlot(index);
+            m_heightTree.add(slot, height - m_heights[slot]);
+            m_heights[slot] = height;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::setAllHeights(unsigned int height)
+        {
+            for (std::size_t slot = 0; slot < m_items.size(); ++slot)
+            {
+                if ((m_removedCount > 0) && m_removed[slot])
+                    m_heights[slot] = 0;
+                else
+                    m_heights[slot] = height;
+            }
+
+            m_heightTree = FenwickTree<unsigned int>(m_heights);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int IndexedItemList::getTop(std::size_t index) const
+        {
+            if (index >= getSize())
+                return getTotalHeight();
+
+            return m_heightTree.getPrefixSum(getSlot(index));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t IndexedItemList::findIndexAtOffset(unsigned int offset) const
+        {
+            // Removed items have no height, so the slot that is found always belongs to an existing item
+            const std::size_t slot = m_heightTree.findPrefix(offset);
+            if (slot >= m_items.size())
+                return getSize();
+
+            return getIndex(slot);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::truncate(std::size_t count)
+        {
+            if (count >= getSize())
+                return;
+
+            if (count == 0)
+            {
+                clear();
+                return;
+            }
+
+            // Keep all slots up to and including the one of the last remaining item
+            const std::size_t slotCount = getSlot(count - 1) + 1;
+            m_items.resize(slotCount);
+            m_heights.resize(slotCount);
+            m_heightTree.truncate(slotCount);
+            if (m_removedCount > 0)
+            {
+                m_removed.resize(slotCount);
+                m_existingSlots.truncate(slotCount);
+                m_removedCount = slotCount - count;
+            }
+
+            clearLookupTables();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::clear()
+        {
+            m_items.clear();
+            m_heights.clear();
+            m_heightTree.clear();
+            m_removed.clear();
+            m_existingSlots.clear();
+            m_removedCount = 0;
+
+            clearLookupTables();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t IndexedItemList::findText(const sf::String& text) const
+        {
+            buildLookupTables();
+
+            // The text is converted once so that it can be compared with the stored items without decoding them
+            const CompactString key{text};
+            std::size_t bestSlot = NotFound;
+            const auto range = m_textLookupTable.equal_range(hashString(key));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if ((it->second < bestSlot) && (m_items[it->second].text == key))
+                    bestSlot = it->second;
+            }
+
+            return (bestSlot != NotFound) ? getIndex(bestSlot) : NotFound;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t IndexedItemList::findId(const sf::String& id) const
+        {
+            // Items without id aren't stored in the lookup table, but they are usually found near the front of the list
+            if (id.isEmpty())
+            {
+                for (std::size_t slot = 0; slot < m_items.size(); ++slot)
+                {
+                    if (m_items[slot].id.isEmpty() && ((m_removedCount == 0) || !m_removed[slot]))
+                        return getIndex(slot);
+                }
+
+                return NotFound;
+            }
+
+            buildLookupTables();
+
+            const CompactString key{id};
+            std::size_t bestSlot = NotFound;
+            const auto range = m_idLookupTable.equal_range(hashString(key));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if ((it->second < bestSlot) && (m_items[it->second].id == key))
+                    bestSlot = it->second;
+            }
+
+            return (bestSlot != NotFound) ? getIndex(bestSlot) : NotFound;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<std::size_t> IndexedItemList::findTextsContaining(const sf::String& text) const
+        {
+            const CompactString key{text};
+            const std::string& utf8 = key.getUtf8();
+
+            // Find the slots that have to be compared with the text. When the text is too short then all slots are checked.
+            std::vector<std::uint32_t> candidates;
+            const auto trigrams = getTrigrams(utf8);
+            if (trigrams.empty())
+            {
+                candidates.resize(m_items.size());
+                for (std::size_t slot = 0; slot < m_items.size(); ++slot)
+                    candidates[slot] = static_cast<std::uint32_t>(slot);
+            }
+            else
+            {
+                if (!m_trigramTableBuilt)
+                {
+                    for (std::size_t slot = 0; slot < m_items.size(); ++slot)
+                        insertIntoTrigramTable(slot);
+
+                    m_trigramTableBuilt = true;
+                }
+
+                std::vector<const std::vector<std::uint32_t>*> lists;
+                for (const auto trigram : trigrams)
+                {
+                    const auto it = m_trigramTable.find(trigram);
+                    if (it == m_trigramTable.end())
+                        return {};
+
+                    lists.push_back(&it->second);
+                }
+
+                // Start with the shortest list and only keep the slots that also occur in the other lists.
+                // Slots are searched in lists that are much longer, otherwise both lists are walked through at the same time.
+                std::sort(lists.begin(), lists.end(), [](const std::vector<std::uint32_t>* left, const std::vector<std::uint32_t>* right){ return left->size() < right->size(); });
+                candidates = *lists[0];
+                for (std::size_t i = 1; (i < lists.size()) && !candidates.empty(); ++i)
+                {
+                    const auto& list = *lists[i];
+                    if (candidates.size() * 32 < list.size())
+                    {
+                        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                                        [&list](std::uint32_t slot){ return !std::binary_search(list.begin(), list.end(), slot); }),
+                                         candidates.end());
+                    }
+                    else
+                    {
+                        const auto end = std::set_intersection(candidates.begin(), candidates.end(), list.begin(), list.end(), candidates.begin());
+                        candidates.erase(end, candidates.end());
+                    }
+                }
+            }
+
+            // Containing all trigrams doesn't mean that they are in the right order, so the texts still have to be compared
+            // (unless the text consists of a single trigram)
+            const bool compareTexts = (trigrams.empty() || (utf8.size() > 3));
+            std::vector<std::size_t> indices;
+            indices.reserve(candidates.size());
+            for (const auto slot : candidates)
+            {
+                if ((m_removedCount > 0) && m_removed[slot])
+                    continue;
+
+                if (!compareTexts || (m_items[slot].text.getUtf8().find(utf8) != std::string::npos))
+                    indices.push_back(getIndex(slot));
+            }
+
+            return indices;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t IndexedItemList::getSlot(std::size_t index) const
+        {
+            if (m_removedCount == 0)
+                return index;
+            else
+                return m_existingSlots.findPrefix(index);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t IndexedItemList::getIndex(std::size_t slot) const
+        {
+            if (m_removedCount == 0)
+                return slot;
+            else
+                return m_existingSlots.getPrefixSum(slot);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::buildLookupTables() const
+        {
+            if (m_lookupTablesBuilt)
+                return;
+
+            m_textLookupTable.reserve(m_items.size());
+            for (std::size_t slot = 0; slot < m_items.size(); ++slot)
+            {
+                if ((m_removedCount == 0) || !m_removed[slot])
+                    insertIntoLookupTables(slot);
+            }
+
+            m_lookupTablesBuilt = true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::insertIntoLookupTables(std::size_t slot) const
+        {
+            m_textLookupTable.emplace(hashString(m_items[slot].text), slot);
+
+            if (!m_items[slot].id.isEmpty())
+                m_idLookupTable.emplace(hashString(m_items[slot].id), slot);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::eraseFromLookupTables(std::size_t slot) const
+        {
+            const auto eraseSlot = [slot](std::unordered_multimap<std::size_t, std::size_t>& table, const CompactString& key){
+                const auto range = table.equal_range(hashString(key));
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (it->second == slot)
+                    {
+                        table.erase(it);
+                        return;
+                    }
+                }
+            };
+
+            eraseSlot(m_textLookupTable, m_items[slot].text);
+
+            if (!m_items[slot].id.isEmpty())
+                eraseSlot(m_idLookupTable, m_items[slot].id);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::insertIntoTrigramTable(std::size_t slot) const
+        {
+            // A trigram that occurs multiple times in the text finds the slot already in its list
+            forEachTrigram(m_items[slot].text.getUtf8(), [this,slot](std::uint32_t trigram){
+                // Items are usually added at the back, in which case the slot can simply be appended
+                auto& list = m_trigramTable[trigram];
+                if (list.empty() || (list.back() < slot))
+                    list.push_back(static_cast<std::uint32_t>(slot));
+                else
+                {
+                    const auto it = std::lower_bound(list.begin(), list.end(), static_cast<std::uint32_t>(slot));
+                    if ((it == list.end()) || (*it != slot))
+                        list.insert(it, static_cast<std::uint32_t>(slot));
+                }
+            });
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::eraseFromTrigramTable(std::size_t slot) const
+        {
+            for (const auto trigram : getTrigrams(m_items[slot].text.getUtf8()))
+            {
+                const auto listIt = m_trigramTable.find(trigram);
+                if (listIt == m_trigramTable.end())
+                    continue;
+
+                auto& list = listIt->second;
+                const auto it = std::lower_bound(list.begin(), list.end(), static_cast<std::uint32_t>(slot));
+                if ((it != list.end()) && (*it == slot))
+                    list.erase(it);
+
+                if (list.empty())
+                    m_trigramTable.erase(listIt);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::clearLookupTables() const
+        {
+            m_textLookupTable.clear();
+            m_idLookupTable.clear();
+            m_lookupTablesBuilt = false;
+
+            m_trigramTable.clear();
+            m_trigramTableBuilt = false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void IndexedItemList::compact()
+        {
+            std::vector<Item> items;
+            std::vector<unsigned int> heights;
+            items.reserve(getSize());
+            heights.reserve(getSize());
+            for (std::size_t slot = 0; slot < m_items.size(); ++slot)
+            {
+                if (!m_removed[slot])
+                {
+                    items.push_back(std::move(m_items[slot]));
+                    heights.push_back(m_heights[slot]);
+                }
+            }
+
+            m_items = std::move(items);
+            m_heights = std::move(heights);
+            m_heightTree = FenwickTree<unsigned int>(m_heights);
+            m_removed.clear();
+            m_existingSlots.clear();
+            m_removedCount = 0;
+
+            // The slots of the items changed, the tables are rebuilt when they are needed again
+            clearLookupTables();
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,520 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/ItemView.hpp>
+#include <TGUI/WorkerPool.hpp>
+#include <algorithm>
+#include <numeric>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            // Amount of items that are sorted together before the sorted ranges are merged
+            const std::size_t sortChunkSize = 4096;
+
+            // When fewer items were added, they are inserted one by one instead of merging them with all existing items
+            const std::size_t maxInsertedPendingItems = 64;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::setComparator(Comparator comparator, const IndexedItemList& items)
+        {
+            // Sorting doesn't change which items pass the filter
+            const std::vector<bool> shown = getShownItems(items.getSize());
+
+            m_comparator = std::move(comparator);
+            if (!isActive())
+            {
+                m_itemElements.clear();
+                m_order.clear();
+                m_pendingItems.clear();
+                return;
+            }
+
+            const std::size_t count = items.getSize();
+            std::vector<std::size_t> order(count);
+            std::iota(order.begin(), order.end(), 0);
+
+            if (m_comparator)
+            {
+                // Every item is only converted once instead of every time it is compared
+                std::vector<sf::String> keys(count);
+                const auto less = [this,&keys](std::size_t left, std::size_t right){ return m_comparator(keys[left], keys[right]); };
+
+                // Sort parts of the list on different threads and then merge them, also in parallel
+                const std::size_t chunkCount = (count + sortChunkSize - 1) / sortChunkSize;
+                WorkerPool::parallelFor(chunkCount, count, [&](std::size_t chunk){
+                    const std::size_t begin = chunk * sortChunkSize;
+                    const std::size_t end = std::min(begin + sortChunkSize, count);
+                    for (std::size_t i = begin; i < end; ++i)
+                        keys[i] = items[i].text.toString();
+
+                    std::stable_sort(order.begin() + begin, order.begin() + end, less);
+                });
+
+                for (std::size_t width = sortChunkSize; width < count; width *= 2)
+                {
+                    WorkerPool::parallelFor((count + 2 * width - 1) / (2 * width), count, [&](std::size_t pair){
+                        const std::size_t begin = pair * 2 * width;
+                        const std::size_t middle = std::min(begin + width, count);
+                        const std::size_t end = std::min(begin + 2 * width, count);
+                        std::inplace_merge(order.begin() + begin, order.begin() + middle, order.begin() + end, less);
+                    });
+                }
+            }
+
+            rebuild(items, order, shown);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::setFilter(const sf::String& text, const IndexedItemList& items)
+        {
+            m_predicate = nullptr;
+            m_filterText = text;
+            m_filterUtf8 = CompactString{text}.getUtf8();
+            m_filtered = !text.isEmpty();
+
+            applyFilter(items);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::setFilter(Predicate predicate, const IndexedItemList& items)
+        {
+            m_predicate = std::move(predicate);
+            m_filterText.clear();
+            m_filterUtf8.clear();
+            m_filtered = static_cast<bool>(m_predicate);
+
+            applyFilter(items);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::itemAdded(const IndexedItemList& items)
+        {
+            if (!isActive())
+                return;
+
+            const std::size_t index = items.getSize() - 1;
+            const bool shown = !m_filtered || matchesFilter(items[index]);
+            if (m_filtered && shown)
+                m_shownHeight += items.getHeight(index);
+
+            const std::size_t element = m_itemElements.insert(index, SequenceTree::None, 0, shown);
+            if (m_comparator)
+                m_pendingItems.push_back(element);
+            else // Without sorting the new item simply becomes the last row
+                m_itemElements.setPayload(element, m_order.insert(m_order.getSize(), element, items.getHeight(index), shown));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::itemRemoved(std::size_t index, const IndexedItemList& items)
+        {
+            if (!isActive())
+                return;
+
+            const std::size_t element = m_itemElements.at(index);
+            if (m_filtered && m_itemElements.isCounted(element))
+                m_shownHeight -= items.getHeight(index);
+
+            // Only the items that were added or changed since the rows were last needed are pending
+            if (m_itemElements.getPayload(element) == SequenceTree::None)
+                m_pendingItems.erase(std::find(m_pendingItems.begin(), m_pendingItems.end(), element));
+
+            removeElement(element);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::itemTextChanged(std::size_t index, const IndexedItemList& items)
+        {
+            if (!isActive())
+                return;
+
+            const std::size_t element = m_itemElements.at(index);
+            const std::size_t row = m_itemElements.getPayload(element);
+            if (m_filtered)
+            {
+                const bool shown = matchesFilter(items[index]);
+                if (shown != m_itemElements.isCounted(element))
+                {
+                    if (shown)
+                        m_shownHeight += items.getHeight(index);
+                    else
+                        m_shownHeight -= items.getHeight(index);
+
+                    m_itemElements.setWeight(element, 0, shown);
+                    if (row != SequenceTree::None)
+                        m_order.setWeight(row, items.getHeight(index), shown);
+                }
+            }
+
+            // The item has to be sorted again, unless it is already waiting for that
+            if (m_comparator && (row != SequenceTree::None))
+            {
+                m_order.erase(row);
+                m_itemElements.setPayload(element, SequenceTree::None);
+                m_pendingItems.push_back(element);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::itemHeightChanged(std::size_t index, unsigned int oldHeight, const IndexedItemList& items)
+        {
+            if (!isActive())
+                return;
+
+            const std::size_t element = m_itemElements.at(index);
+            if (m_filtered && m_itemElements.isCounted(element))
+                m_shownHeight += items.getHeight(index) - oldHeight;
+
+            // The item keeps its row, only the height of the row changes
+            const std::size_t row = m_itemElements.getPayload(element);
+            if (row != SequenceTree::None)
+                m_order.setWeight(row, items.getHeight(index), m_order.isCounted(row));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::allHeightsChanged(const IndexedItemList& items)
+        {
+            if (!isActive())
+                return;
+
+            update(items);
+            rebuild(items, getOrder(), getShownItems(items.getSize()));
+
+            if (m_filtered)
+                m_shownHeight = m_order.getCountedWeight();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::itemsTruncated(std::size_t count, const IndexedItemList& items)
+        {
+            if (!isActive())
+                return;
+
+            const auto isRemoved = [this,count](std::size_t element){ return m_itemElements.getPosition(element) >= count; };
+            m_pendingItems.erase(std::remove_if(m_pendingItems.begin(), m_pendingItems.end(), isRemoved), m_pendingItems.end());
+
+            while (m_itemElements.getSize() > count)
+                removeElement(m_itemElements.at(m_itemElements.getSize() - 1));
+
+            // The heights of the removed items are no longer known, but the remaining shown items are all in the rows
+            update(items);
+            if (m_filtered)
+                m_shownHeight = m_order.getCountedWeight();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::itemsCleared()
+        {
+            m_shownHeight = 0;
+            m_itemElements.clear();
+            m_order.clear();
+            m_pendingItems.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t ItemView::getRowCount(const IndexedItemList& items) const
+        {
+            if (!isActive())
+                return items.getSize();
+
+            update(items);
+            return m_order.getCountedSize();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t ItemView::getItemIndex(std::size_t row, const IndexedItemList& items) const
+        {
+            if (!isActive())
+                return row;
+
+            update(items);
+            return m_itemElements.getPosition(m_order.getPayload(m_order.atCounted(row)));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t ItemView::findRow(std::size_t index, const IndexedItemList& items) const
+        {
+            if (!isActive())
+                return (index < items.getSize()) ? index : IndexedItemList::NotFound;
+
+            update(items);
+            if (index >= m_itemElements.getSize())
+                return IndexedItemList::NotFound;
+
+            const std::size_t row = m_itemElements.getPayload(m_itemElements.at(index));
+            if (!m_order.isCounted(row))
+                return IndexedItemList::NotFound;
+
+            return m_order.getCountedPosition(row);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int ItemView::getRowTop(std::size_t row, const IndexedItemList& items) const
+        {
+            if (!isActive())
+                return items.getTop(row);
+
+            update(items);
+            return m_order.getCountedWeightBefore(row);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t ItemView::findRowAtOffset(unsigned int offset, const IndexedItemList& items) const
+        {
+            if (!isActive())
+                return items.findIndexAtOffset(offset);
+
+            update(items);
+            return m_order.findCountedAtWeight(offset);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int ItemView::getTotalHeight(const IndexedItemList& items) const
+        {
+            if (m_filtered)
+                return m_shownHeight;
+            else
+                return items.getTotalHeight();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool ItemView::matchesFilter(const IndexedItemList::Item& item) const
+        {
+            if (m_predicate)
+                return m_predicate(item.text.toString());
+            else
+                return item.text.getUtf8().find(m_filterUtf8) != std::string::npos;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::applyFilter(const IndexedItemList& items)
+        {
+            m_shownHeight = 0;
+            if (!isActive())
+            {
+                m_itemElements.clear();
+                m_order.clear();
+                m_pendingItems.clear();
+                return;
+            }
+
+            // The sort order doesn't change when filtering
+            std::vector<std::size_t> order;
+            if (m_comparator)
+            {
+                update(items);
+                order = getOrder();
+            }
+            else
+            {
+                order.resize(items.getSize());
+                std::iota(order.begin(), order.end(), 0);
+            }
+
+            rebuild(items, order, findShownItems(items));
+            if (m_filtered)
+                m_shownHeight = m_order.getCountedWeight();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::removeElement(std::size_t element)
+        {
+            const std::size_t row = m_itemElements.getPayload(element);
+            if (row != SequenceTree::None)
+                m_order.erase(row);
+
+            m_itemElements.erase(element);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<bool> ItemView::findShownItems(const IndexedItemList& items) const
+        {
+            if (!m_filtered)
+                return std::vector<bool>(items.getSize(), true);
+
+            std::vector<bool> shown(items.getSize(), false);
+            if (m_predicate)
+            {
+                for (std::size_t i = 0; i < shown.size(); ++i)
+                    shown[i] = matchesFilter(items[i]);
+            }
+            else // The item list has an index to quickly find the items containing the text
+            {
+                for (const auto index : items.findTextsContaining(m_filterText))
+                    shown[index] = true;
+            }
+
+            return shown;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<bool> ItemView::getShownItems(std::size_t itemCount) const
+        {
+            if (!m_filtered)
+                return std::vector<bool>(itemCount, true);
+
+            std::vector<bool> shown;
+            shown.reserve(itemCount);
+            for (const auto element : m_itemElements.getHandles())
+                shown.push_back(m_itemElements.isCounted(element));
+
+            return shown;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<std::size_t> ItemView::getOrder() const
+        {
+            const std::vector<std::size_t> elements = m_itemElements.getHandles();
+            std::vector<std::size_t> indices(m_itemElements.getHandleLimit());
+            for (std::size_t i = 0; i < elements.size(); ++i)
+                indices[elements[i]] = i;
+
+            std::vector<std::size_t> order;
+            order.reserve(m_order.getSize());
+            for (const auto row : m_order.getHandles())
+                order.push_back(indices[m_order.getPayload(row)]);
+
+            return order;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::rebuild(const IndexedItemList& items, const std::vector<std::size_t>& order, const std::vector<bool>& shown) const
+        {
+            std::vector<SequenceTree::Element> elements(items.getSize(), SequenceTree::Element{SequenceTree::None, 0, false});
+            for (std::size_t i = 0; i < elements.size(); ++i)
+                elements[i].counted = shown[i];
+
+            const std::vector<std::size_t> itemElements = m_itemElements.build(elements);
+
+            std::vector<SequenceTree::Element> rows;
+            rows.reserve(order.size());
+            for (const auto index : order)
+                rows.push_back({itemElements[index], items.getHeight(index), shown[index]});
+
+            const std::vector<std::size_t> rowElements = m_order.build(rows);
+            for (std::size_t i = 0; i < order.size(); ++i)
+                m_itemElements.setPayload(itemElements[order[i]], rowElements[i]);
+
+            m_pendingItems.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::update(const IndexedItemList& items) const
+        {
+            if (!m_pendingItems.empty())
+                mergePendingItems(items);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ItemView::mergePendingItems(const IndexedItemList& items) const
+        {
+            // Sort the new items among themselves
+            std::vector<std::size_t> indices;
+            std::vector<sf::String> keys;
+            indices.reserve(m_pendingItems.size());
+            keys.reserve(m_pendingItems.size());
+            for (const auto element : m_pendingItems)
+            {
+                indices.push_back(m_itemElements.getPosition(element));
+                keys.push_back(items[indices.back()].text.toString());
+            }
+
+            std::vector<std::size_t> order(m_pendingItems.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [this,&keys](std::size_t left, std::size_t right){ return m_comparator(keys[left], keys[right]); });
+
+            if (m_pendingItems.size() < maxInsertedPendingItems)
+            {
+                // Insert the few new items at their place, which only requires comparing the texts of O(log n) items
+                for (const auto i : order)
+                {
+                    const std::size_t position = m_order.findFirst([this,&items,&keys,i](std::size_t row){
+                        return m_comparator(keys[i], items[m_itemElements.getPosition(m_order.getPayload(row))].text.toString());
+                    });
+
+                    const std::size_t element = m_pendingItems[i];
+                    const std::size_t row = m_order.insert(position, element, items.getHeight(indices[i]), m_itemElements.isCounted(element));
+                    m_itemElements.setPayload(element, row);
+                }
+
+                m_pendingItems.clear();
+            }
+            else // Merge the new items with all existing items in a single pass
+            {
+                std::vector<std::size_t> merged;
+                merged.reserve(items.getSize());
+
+                std::size_t next = 0;
+                for (const auto index : getOrder())
+                {
+                    const sf::String key = items[index].text.toString();
+                    while ((next < order.size()) && m_comparator(keys[order[next]], key))
+                        merged.push_back(indices[order[next++]]);
+
+                    merged.push_back(index);
+                }
+
+                for (; next < order.size(); ++next)
+                    merged.push_back(indices[order[next]]);
+
+                rebuild(items, merged, getShownItems(items.getSize()));
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -581,10 +581,10 @@ namespace tgui
                     if (container != nullptr)
                     {
                         const auto& widgets = container->getWidgets();
-                        const auto& widgetNames = container->getWidgetNames();
+                        const auto& widgetNames = container->getStoredWidgetNames();
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
-                            if (toLower(widgetNames[i]) == widgetName)
+                            if (toLower(widgetNames[i].getUtf8()) == widgetName)
                                 return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
@@ -593,10 +593,10 @@ namespace tgui
                     if (widget->getParent())
                     {
                         const auto& widgets = widget->getParent()->getWidgets();
-                        const auto& widgetNames = widget->getParent()->getWidgetNames();
+                        const auto& widgetNames = widget->getParent()->getStoredWidgetNames();
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
-                            if (toLower(widgetNames[i]) == widgetName)
+                            if (toLower(widgetNames[i].getUtf8()) == widgetName)
                                 return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
                         }
                     }
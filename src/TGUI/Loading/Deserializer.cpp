@@ -27,12 +27,19 @@
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/FontCache.hpp>
 #include <cassert>
+#include <map>
 
 namespace tgui
 {
     namespace
     {
+        // Fonts that were loaded from a file, they are shared as long as someone is still using them
+        priv::FontCache<std::string> loadedFonts;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         unsigned char hexToDec(char c)
         {
             assert((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F')  || (c >= 'a' && c <= 'f'));
@@ -94,16 +101,25 @@ namespace tgui
             if (filename.isEmpty())
                 return Font{};
 
-            // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
+            // Insert the resource path into the filename unless the filename is an absolute path
+            std::string fullFilename;
         #ifdef SFML_SYSTEM_WINDOWS
             if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
         #else
             if (filename[0] != '/')
         #endif
-                font->loadFromFile(getResourcePath() + filename);
+                fullFilename = getResourcePath() + filename;
             else
-                font->loadFromFile(filename);
+                fullFilename = filename;
+
+            // Reuse the font when it is still loaded, so that the glyphs that were already rendered are shared
+            const auto loadedFont = loadedFonts.findFont(fullFilename);
+            if (loadedFont)
+                return Font(loadedFont);
+
+            auto font = std::make_shared<sf::Font>();
+            if (font->loadFromFile(fullFilename))
+                loadedFonts.insert(fullFilename, font);
 
             return Font(font);
         }
@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Global.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +34,35 @@ namespace tgui
 {
     namespace
     {
+        // Returns the elements of a list like "[a, b, c]"
+        std::vector<std::string> splitList(const std::string& property, const sf::String& value)
+        {
+            const std::string str = trim(value);
+            if ((str.size() < 2) || (str[0] != '[') || (str[str.size()-1] != ']'))
+                throw Exception{"Failed to parse '" + property + "' property in Glyphs section of theme, expected a list between square brackets."};
+
+            if (trim(str.substr(1, str.size() - 2)).empty())
+                return {};
+
+            return Deserializer::split(str.substr(1, str.size() - 2), ',');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Parses a hexadecimal code point like "U+3040" or "0x3040"
+        sf::Uint32 parseCodePoint(std::string str)
+        {
+            if ((str.size() > 2) && ((toLower(str.substr(0, 2)) == "u+") || (toLower(str.substr(0, 2)) == "0x")))
+                str.erase(0, 2);
+
+            if (str.empty() || (str.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) || (str.size() > 8))
+                throw Exception{"Failed to parse code point '" + str + "' in Glyphs section of theme."};
+
+            return static_cast<sf::Uint32>(std::stoul(str, nullptr, 16));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         struct DefaultTheme : public Theme
         {
             DefaultTheme()
@@ -224,7 +254,10 @@ namespace tgui
         m_primary(primary)
     {
         if (!primary.empty())
+        {
             m_themeLoader->preload(primary);
+            preloadGlyphs();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,6 +274,7 @@ namespace tgui
     {
         m_primary = primary;
         m_themeLoader->preload(primary);
+        preloadGlyphs();
 
         // Update the existing renderers
         for (auto& pair : m_renderers)
@@ -368,6 +402,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const Font::GlyphPreloadStatistics& Theme::getGlyphPreloadStatistics() const
+    {
+        return m_glyphPreloadStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Theme::setThemeLoader(std::shared_ptr<BaseThemeLoader> themeLoader)
     {
         m_themeLoader = themeLoader;
@@ -401,6 +442,55 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::preloadGlyphs()
+    {
+        m_preloadedFont = nullptr;
+        m_glyphPreloadStatistics = {};
+
+        if (m_primary.empty() || !m_themeLoader->canLoad(m_primary, "glyphs"))
+            return;
+
+        const auto& properties = m_themeLoader->load(m_primary, "glyphs");
+        for (const auto& property : {"font", "ranges", "textsizes"})
+        {
+            if (properties.find(property) == properties.end())
+                throw Exception{"Glyphs section of theme is missing the '" + std::string(property) + "' property."};
+        }
+
+        std::vector<Font::GlyphRange> ranges;
+        for (const auto& range : splitList("Ranges", properties.at("ranges")))
+        {
+            // Both "U+0041" and "U+0041-U+005A" are allowed
+            const auto dashPos = range.find('-');
+            if (dashPos == std::string::npos)
+                ranges.push_back({parseCodePoint(range), parseCodePoint(range)});
+            else
+                ranges.push_back({parseCodePoint(trim(range.substr(0, dashPos))), parseCodePoint(trim(range.substr(dashPos + 1)))});
+
+            if (ranges.back().first > ranges.back().last)
+                throw Exception{"Failed to parse glyph range '" + range + "' in Glyphs section of theme, the range is reversed."};
+        }
+
+        std::vector<unsigned int> textSizes;
+        for (const auto& textSize : splitList("TextSizes", properties.at("textsizes")))
+        {
+            const int size = tgui::stoi(textSize);
+            if (size <= 0)
+                throw Exception{"Failed to parse text size '" + textSize + "' in Glyphs section of theme."};
+
+            textSizes.push_back(static_cast<unsigned int>(size));
+        }
+
+        bool bold = false;
+        if (properties.find("bold") != properties.end())
+            bold = Deserializer::deserialize(ObjectConverter::Type::Bool, properties.at("bold")).getBool();
+
+        m_preloadedFont = Deserializer::deserialize(ObjectConverter::Type::Font, properties.at("font")).getFont();
+        m_glyphPreloadStatistics = m_preloadedFont.preloadGlyphs(ranges, textSizes, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
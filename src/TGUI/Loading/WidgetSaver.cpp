@@ -358,7 +358,7 @@ namespace tgui
             if (comboBox->getItemCount() > 0)
             {
                 auto items = comboBox->getItems();
-                auto& ids = comboBox->getItemIds();
+                const auto ids = comboBox->getItemIds();
 
                 std::string itemList = "[" + Serializer::serialize(items[0]);
                 std::string itemIdList = "[" + Serializer::serialize(ids[0]);
@@ -556,7 +556,7 @@ namespace tgui
             if (listBox->getItemCount() > 0)
             {
                 auto items = listBox->getItems();
-                auto& ids = listBox->getItemIds();
+                const auto ids = listBox->getItemIds();
 
                 std::string itemList = "[" + Serializer::serialize(items[0]);
                 std::string itemIdList = "[" + Serializer::serialize(ids[0]);
@@ -0,0 +1,815 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <iterator>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    std::size_t roundToTriangles(std::size_t count)
+    {
+        return (count + 2) / 3 * 3;
+    }
+
+    // Versions 1 and 2 are used for rectangles and borders, which are recognized by their size
+    const std::size_t rectangleVersion = 1;
+    const std::size_t bordersVersion = 2;
+    std::atomic<std::size_t> lastGeometryVersion{bordersVersion};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        RenderBatch* RenderBatch::m_activeBatch = nullptr;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderBatch::OwnerScope::OwnerScope(RenderBatch* batch, const void* owner) :
+            m_batch{batch}
+        {
+            if (!m_batch)
+                return;
+
+            m_previousOwner = m_batch->m_owner;
+            m_previousPiece = m_batch->m_piece;
+            m_batch->m_owner = owner;
+            m_batch->m_piece = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderBatch::OwnerScope::~OwnerScope()
+        {
+            if (!m_batch)
+                return;
+
+            m_batch->m_owner = m_previousOwner;
+            m_batch->m_piece = m_previousPiece;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::begin(sf::RenderTarget& target)
+        {
+            assert(m_target == nullptr);
+
+            m_target = &target;
+            m_texture = nullptr;
+            m_shader = nullptr;
+            m_vertexCount = 0;
+            m_flushedVertexCount = 0;
+            m_owner = nullptr;
+            m_piece = 0;
+            m_paused = false;
+            m_drawCalls = 0;
+            m_allocations = 0;
+            m_uploads = 0;
+
+            m_pieces.clear();
+            m_flushedPieceCount = 0;
+            m_usedSlotCount = 0;
+            m_overflowSize = 0;
+            m_scatteredDrawCalls = 0;
+            ++m_frame;
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            m_useVertexBuffer = sf::VertexBuffer::isAvailable();
+        #endif
+
+            m_previousBatch = m_activeBatch;
+            m_activeBatch = this;
+
+            // Geometry that was queued for the outer batch has to be drawn before ours
+            if (m_previousBatch)
+                m_previousBatch->flush();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::end()
+        {
+            assert(m_target != nullptr);
+
+            flush();
+
+            // The slots of geometry that is no longer drawn are released, which leaves a gap between the other slots
+            if (m_usedSlotCount != m_slots.size())
+            {
+                for (auto it = m_slots.begin(); it != m_slots.end();)
+                {
+                    if (it->second.frame != m_frame)
+                    {
+                        releaseSlot(it->second);
+                        it = m_slots.erase(it);
+                    }
+                    else
+                        ++it;
+                }
+            }
+
+            // Placing all slots in the drawing order requires all geometry to be uploaded again, which is only done when
+            // the slots that were moved (or the gaps between them) split more than half of the draw calls, or when the
+            // gaps take more room in the vertex buffer than the slots themselves. New slots are only ever placed behind
+            // the others, so without the latter the gaps left by widgets that are recreated every frame would keep growing.
+            if ((2 * m_scatteredDrawCalls > m_drawCalls) || (m_usedBufferSize - m_placedBufferSize > m_placedBufferSize))
+            {
+                // The pieces that didn't fit are written again in the next frame, the buffer only grows when they
+                // still don't fit once the slots are placed next to each other.
+                resetSlots();
+                m_overflowSize = 0;
+            }
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            if (m_overflowSize > 0)
+                growVertexBuffer();
+        #endif
+
+            // A nested batch (e.g. the one filling the render cache of a container) is part of drawing the outer batch
+            if (m_previousBatch)
+                m_previousBatch->m_allocations += m_allocations;
+
+            m_activeBatch = m_previousBatch;
+            m_previousBatch = nullptr;
+            m_target = nullptr;
+            m_drawCallsLastFrame = m_drawCalls;
+            m_allocationsLastFrame = m_allocations;
+            m_uploadsLastFrame = m_uploads;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::flush()
+        {
+            if ((m_vertexCount == m_flushedVertexCount) && (m_flushedPieceCount == m_pieces.size()))
+                return;
+
+            sf::RenderStates states;
+            states.texture = m_texture;
+            states.shader = m_shader;
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            if (m_useVertexBuffer)
+            {
+                uploadPieces(m_flushedPieceCount);
+                drawPieces(states);
+            }
+            else
+        #endif
+            {
+                const std::size_t count = m_vertexCount - m_flushedVertexCount;
+                m_target->draw(m_vertices.data() + m_flushedVertexCount, count, sf::PrimitiveType::Triangles, states);
+                m_uploads += count;
+                ++m_drawCalls;
+            }
+
+            m_flushedVertexCount = m_vertexCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addTriangleStrip(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, std::size_t version)
+        {
+            if (vertexCount < 3)
+                return;
+
+            if (!prepareStates(states))
+            {
+                m_target->draw(vertices, vertexCount, sf::PrimitiveType::TrianglesStrip, states);
+                m_uploads += vertexCount;
+                ++m_drawCalls;
+                return;
+            }
+
+            Slot* const slot = nextSlot();
+            const Signature signature{version, states.transform, {}};
+            if (reuseSlot(slot, signature))
+                return;
+
+            // The strip is split in separate triangles, so that it can be merged with the geometry of other widgets.
+            // The transformation is applied here as the whole batch is drawn with an identity transform.
+            sf::Vertex* out = reserveVertices(3 * (vertexCount - 2));
+            sf::Vertex* const begin = out;
+            sf::Vertex prev2 = vertices[0];
+            sf::Vertex prev1 = vertices[1];
+            prev2.position = states.transform.transformPoint(prev2.position);
+            prev1.position = states.transform.transformPoint(prev1.position);
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                sf::Vertex vertex = vertices[i];
+                vertex.position = states.transform.transformPoint(vertex.position);
+
+                // Degenerate triangles (e.g. used to connect the rows of a strip) don't have to be drawn
+                if ((prev2.position != prev1.position) && (prev1.position != vertex.position) && (prev2.position != vertex.position))
+                {
+                    *out++ = prev2;
+                    *out++ = prev1;
+                    *out++ = vertex;
+                }
+
+                prev2 = prev1;
+                prev1 = vertex;
+            }
+
+            const std::size_t first = m_vertexCount;
+            m_vertexCount += static_cast<std::size_t>(out - begin);
+            addPiece(slot, first, signature);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addTriangles(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, std::size_t version)
+        {
+            addTriangleList(vertices, vertexCount, states, nullptr, version);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addTriangles(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, sf::Color color, std::size_t version)
+        {
+            addTriangleList(vertices, vertexCount, states, &color, version);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addRectangle(sf::Vector2f size, sf::Color color, const sf::RenderStates& states)
+        {
+            if ((size.x <= 0) || (size.y <= 0))
+                return;
+
+            if (!prepareStates(states))
+            {
+                const sf::Vertex vertices[] = {
+                    {{0, 0}, color},
+                    {{0, size.y}, color},
+                    {{size.x, 0}, color},
+                    {{size.x, size.y}, color}
+                };
+
+                m_target->draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
+                m_uploads += 4;
+                ++m_drawCalls;
+                return;
+            }
+
+            Slot* const slot = nextSlot();
+            const Signature signature{rectangleVersion, states.transform, color, {size.x, size.y}};
+            if (reuseSlot(slot, signature))
+                return;
+
+            writeQuad(reserveVertices(6), states.transform, {0, 0, size.x, size.y}, color);
+
+            const std::size_t first = m_vertexCount;
+            m_vertexCount += 6;
+            addPiece(slot, first, signature);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addBorders(const Borders& borders, sf::Vector2f size, sf::Color color, const sf::RenderStates& states)
+        {
+            // If size is too small then draw entire size as border
+            if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
+            {
+                addRectangle(size, color, states);
+                return;
+            }
+
+            if (!prepareStates(states))
+            {
+                // Same layout as the triangle strip in Widget::drawBorders
+                const sf::Vertex vertices[] = {
+                    {{0, 0}, color},
+                    {{borders.getLeft(), 0}, color},
+                    {{0, size.y}, color},
+                    {{borders.getLeft(), size.y - borders.getBottom()}, color},
+                    {{size.x, size.y}, color},
+                    {{size.x - borders.getRight(), size.y - borders.getBottom()}, color},
+                    {{size.x, 0}, color},
+                    {{size.x - borders.getRight(), borders.getTop()}, color},
+                    {{borders.getLeft(), 0}, color},
+                    {{borders.getLeft(), borders.getTop()}, color}
+                };
+
+                m_target->draw(vertices, 10, sf::PrimitiveType::TrianglesStrip, states);
+                m_uploads += 10;
+                ++m_drawCalls;
+                return;
+            }
+
+            Slot* const slot = nextSlot();
+            const Signature signature{bordersVersion, states.transform, color,
+                                      {borders.getLeft(), borders.getTop(), borders.getRight(), borders.getBottom(), size.x, size.y}};
+            if (reuseSlot(slot, signature))
+                return;
+
+            // Left and right borders span the whole height, top and bottom borders lie between them
+            const float innerWidth = size.x - borders.getLeft() - borders.getRight();
+            sf::Vertex* out = reserveVertices(24);
+            sf::Vertex* const begin = out;
+            if (borders.getLeft() > 0)
+                out = writeQuad(out, states.transform, {0, 0, borders.getLeft(), size.y}, color);
+            if (borders.getRight() > 0)
+                out = writeQuad(out, states.transform, {size.x - borders.getRight(), 0, borders.getRight(), size.y}, color);
+            if (borders.getTop() > 0)
+                out = writeQuad(out, states.transform, {borders.getLeft(), 0, innerWidth, borders.getTop()}, color);
+            if (borders.getBottom() > 0)
+                out = writeQuad(out, states.transform, {borders.getLeft(), size.y - borders.getBottom(), innerWidth, borders.getBottom()}, color);
+
+            const std::size_t first = m_vertexCount;
+            m_vertexCount += static_cast<std::size_t>(out - begin);
+            addPiece(slot, first, signature);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addNineSlice(sf::Vector2f size, const sf::FloatRect& textureRect, const sf::FloatRect& middleRect, sf::Color color,
+                                       const sf::RenderStates& states, std::size_t version)
+        {
+            if ((size.x <= 0) || (size.y <= 0))
+                return;
+
+            const bool merge = prepareStates(states);
+
+            Slot* const slot = merge ? nextSlot() : nullptr;
+            const Signature signature{version, states.transform, color, {size.x, size.y}};
+            if (reuseSlot(slot, signature))
+                return;
+
+            // The corners keep their size, the sides are stretched in one direction and the middle part in both directions
+            const float x[] = {0, middleRect.left, size.x - (textureRect.width - middleRect.left - middleRect.width), size.x};
+            const float y[] = {0, middleRect.top, size.y - (textureRect.height - middleRect.top - middleRect.height), size.y};
+            const float u[] = {textureRect.left, textureRect.left + middleRect.left, textureRect.left + middleRect.left + middleRect.width,
+                               textureRect.left + textureRect.width};
+            const float v[] = {textureRect.top, textureRect.top + middleRect.top, textureRect.top + middleRect.top + middleRect.height,
+                               textureRect.top + textureRect.height};
+
+            const sf::Transform& transform = merge ? states.transform : sf::Transform::Identity;
+            sf::Vertex* out = reserveVertices(9 * 6);
+            sf::Vertex* const begin = out;
+            for (unsigned int row = 0; row < 3; ++row)
+            {
+                for (unsigned int column = 0; column < 3; ++column)
+                {
+                    // Parts without width or height (e.g. when the image has no borders on one side) are left out
+                    if ((x[column] == x[column + 1]) || (y[row] == y[row + 1]))
+                        continue;
+
+                    out = writeQuad(out, transform, {x[column], y[row], x[column + 1] - x[column], y[row + 1] - y[row]}, color,
+                                    {u[column], v[row], u[column + 1] - u[column], v[row + 1] - v[row]});
+                }
+            }
+
+            const std::size_t vertexCount = static_cast<std::size_t>(out - begin);
+            if (!merge)
+            {
+                m_target->draw(begin, vertexCount, sf::PrimitiveType::Triangles, states);
+                m_uploads += vertexCount;
+                ++m_drawCalls;
+                return;
+            }
+
+            const std::size_t first = m_vertexCount;
+            m_vertexCount += vertexCount;
+            addPiece(slot, first, signature);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::setPaused(bool paused)
+        {
+            if (paused)
+                flush();
+
+            m_paused = paused;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t RenderBatch::getDrawCallCount() const
+        {
+            return m_drawCallsLastFrame;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t RenderBatch::getAllocationCount() const
+        {
+            return m_allocationsLastFrame;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t RenderBatch::getUploadedVertexCount() const
+        {
+            return m_uploadsLastFrame;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t RenderBatch::getVertexBufferSize() const
+        {
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            return m_vertexBuffer.getVertexCount();
+        #else
+            return 0;
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderBatch* RenderBatch::getActive(const sf::RenderTarget& target)
+        {
+            if (m_activeBatch && !m_activeBatch->m_paused && (m_activeBatch->m_target == &target))
+                return m_activeBatch;
+            else
+                return nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::flushActive(const sf::RenderTarget& target)
+        {
+            if (m_activeBatch && !m_activeBatch->m_paused && (m_activeBatch->m_target == &target))
+                m_activeBatch->flush();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::countAllocation()
+        {
+            if (m_activeBatch)
+                ++m_activeBatch->m_allocations;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t RenderBatch::createGeometryVersion()
+        {
+            return ++lastGeometryVersion;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RenderBatch::prepareStates(const sf::RenderStates& states)
+        {
+            // Vertices can only be merged when they would be drawn with the default blend mode and without a shader.
+            // Text drawn from distance fields is the exception, its shader doesn't depend on what is being drawn.
+            const bool distanceFieldShader = (states.shader != nullptr) && DistanceFieldFont::isEnabled()
+                                          && (states.shader == DistanceFieldFont::getShader());
+            if (((states.shader != nullptr) && !distanceFieldShader) || (states.blendMode != sf::BlendAlpha))
+            {
+                flush();
+                return false;
+            }
+
+            if ((states.texture != m_texture) || (states.shader != m_shader))
+            {
+                flush();
+                m_texture = states.texture;
+                m_shader = states.shader;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Vertex* RenderBatch::reserveVertices(std::size_t count)
+        {
+            if (m_vertexCount + count > m_vertices.size())
+            {
+                // Grow exponentially so that the amount of allocations stays small while the arena reaches its final size
+                m_vertices.resize(std::max(m_vertexCount + count, 2 * m_vertices.size()));
+                ++m_allocations;
+            }
+
+            return m_vertices.data() + m_vertexCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addTriangleList(const sf::Vertex* vertices, std::size_t vertexCount, const sf::RenderStates& states, const sf::Color* color, std::size_t version)
+        {
+            if (vertexCount < 3)
+                return;
+
+            const bool merge = prepareStates(states);
+
+            Slot* const slot = merge ? nextSlot() : nullptr;
+            const Signature signature{version, states.transform, color ? *color : sf::Color::White};
+            if (reuseSlot(slot, signature))
+                return;
+
+            // The vertices are written behind the used part of the arena, even when they have to be drawn immediately
+            sf::Vertex* out = reserveVertices(vertexCount);
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                out[i].position = merge ? states.transform.transformPoint(vertices[i].position) : vertices[i].position;
+                out[i].color = color ? *color : vertices[i].color;
+                out[i].texCoords = vertices[i].texCoords;
+            }
+
+            if (!merge)
+            {
+                m_target->draw(out, vertexCount, sf::PrimitiveType::Triangles, states);
+                m_uploads += vertexCount;
+                ++m_drawCalls;
+                return;
+            }
+
+            const std::size_t first = m_vertexCount;
+            m_vertexCount += vertexCount;
+            addPiece(slot, first, signature);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Vertex* RenderBatch::writeQuad(sf::Vertex* out, const sf::Transform& transform, const sf::FloatRect& rect, sf::Color color,
+                                           const sf::FloatRect& textureRect)
+        {
+            const sf::Vector2f topLeft = transform.transformPoint({rect.left, rect.top});
+            const sf::Vector2f topRight = transform.transformPoint({rect.left + rect.width, rect.top});
+            const sf::Vector2f bottomLeft = transform.transformPoint({rect.left, rect.top + rect.height});
+            const sf::Vector2f bottomRight = transform.transformPoint({rect.left + rect.width, rect.top + rect.height});
+
+            const float textureRight = textureRect.left + textureRect.width;
+            const float textureBottom = textureRect.top + textureRect.height;
+
+            *out++ = {topLeft, color, {textureRect.left, textureRect.top}};
+            *out++ = {bottomLeft, color, {textureRect.left, textureBottom}};
+            *out++ = {topRight, color, {textureRight, textureRect.top}};
+            *out++ = {bottomLeft, color, {textureRect.left, textureBottom}};
+            *out++ = {topRight, color, {textureRight, textureRect.top}};
+            *out++ = {bottomRight, color, {textureRight, textureBottom}};
+            return out;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderBatch::Signature::Signature(std::size_t version_, const sf::Transform& transform_, sf::Color color_, std::initializer_list<float> params_) :
+            version{version_},
+            color{color_},
+            params{}
+        {
+            std::copy(transform_.getMatrix(), transform_.getMatrix() + 16, transform);
+            std::copy(params_.begin(), params_.end(), params);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RenderBatch::Signature::operator==(const Signature& other) const
+        {
+            return (version != 0) && (version == other.version) && (color == other.color)
+                && std::equal(std::begin(transform), std::end(transform), std::begin(other.transform))
+                && std::equal(std::begin(params), std::end(params), std::begin(other.params));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderBatch::Slot* RenderBatch::nextSlot()
+        {
+            if (!m_useVertexBuffer)
+                return nullptr;
+
+            // An owner that is drawn more than once per frame gets different slots for each time it is drawn
+            Slot* slot;
+            do
+            {
+                const auto result = m_slots.emplace(SlotKey{m_owner, m_piece++}, Slot{});
+                if (result.second)
+                    ++m_allocations;
+
+                slot = &result.first->second;
+            }
+            while (slot->frame == m_frame);
+
+            slot->frame = m_frame;
+            ++m_usedSlotCount;
+            return slot;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RenderBatch::reuseSlot(Slot* slot, const Signature& signature)
+        {
+            if (!slot || !slot->placed || !(slot->signature == signature))
+                return false;
+
+            pushPiece({slot, 0, slot->count, false, true});
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::addPiece(Slot* slot, std::size_t first, const Signature& signature)
+        {
+            if (!slot || (m_vertexCount == first))
+                return;
+
+            slot->signature = signature;
+            pushPiece({slot, first, m_vertexCount - first, true, false});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::pushPiece(const Piece& piece)
+        {
+            if (m_pieces.size() == m_pieces.capacity())
+                ++m_allocations;
+
+            m_pieces.push_back(piece);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::releaseSlot(Slot& slot)
+        {
+            if (!slot.placed)
+                return;
+
+            slot.placed = false;
+            m_placedBufferSize -= slot.capacity;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::resetSlots()
+        {
+            for (auto& pair : m_slots)
+                pair.second.placed = false;
+
+            m_usedBufferSize = 0;
+            m_placedBufferSize = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        void RenderBatch::uploadPieces(std::size_t firstPiece)
+        {
+            for (std::size_t i = firstPiece; i < m_pieces.size(); ++i)
+            {
+                Piece& piece = m_pieces[i];
+                if (!piece.written || piece.inBuffer)
+                    continue;
+
+                // A piece that doesn't fit is drawn from the arena, the buffer is enlarged when the frame ends
+                if (!uploadPiece(piece))
+                    m_overflowSize += roundToTriangles(piece.count + piece.count / 2);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RenderBatch::uploadPiece(Piece& piece)
+        {
+            Slot& slot = *piece.slot;
+            if (!slot.placed || (piece.count > slot.capacity))
+            {
+                // A slot that had to grow once is likely to grow again, so it gets some room to do so
+                const std::size_t capacity = slot.placed ? roundToTriangles(piece.count + piece.count / 2) : roundToTriangles(piece.count);
+
+                // The place where a slot that grows was stored becomes a gap
+                releaseSlot(slot);
+                if (m_usedBufferSize + capacity > m_vertexBuffer.getVertexCount())
+                    return false;
+
+                slot.offset = m_usedBufferSize;
+                slot.capacity = capacity;
+                slot.count = capacity; // The whole slot has to be written, including the degenerate triangles at the end
+                slot.placed = true;
+                m_usedBufferSize += capacity;
+                m_placedBufferSize += capacity;
+            }
+
+            m_vertexBuffer.update(m_vertices.data() + piece.first, piece.count, static_cast<unsigned int>(slot.offset));
+            m_uploads += piece.count;
+
+            // When the slot contained more vertices before, the remaining triangles are made invisible
+            if (slot.count > piece.count)
+            {
+                const std::size_t degenerateCount = slot.count - piece.count;
+                if (m_degenerateVertices.size() < degenerateCount)
+                {
+                    m_degenerateVertices.resize(degenerateCount);
+                    ++m_allocations;
+                }
+
+                m_vertexBuffer.update(m_degenerateVertices.data(), degenerateCount, static_cast<unsigned int>(slot.offset + piece.count));
+                m_uploads += degenerateCount;
+            }
+
+            slot.count = piece.count;
+            piece.inBuffer = true;
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::drawPieces(const sf::RenderStates& states)
+        {
+            std::size_t i = m_flushedPieceCount;
+            while (i < m_pieces.size())
+            {
+                const bool inBuffer = m_pieces[i].inBuffer;
+                const std::size_t first = inBuffer ? m_pieces[i].slot->offset : m_pieces[i].first;
+                std::size_t end = first + (inBuffer ? m_pieces[i].slot->capacity : m_pieces[i].count);
+                for (++i; i < m_pieces.size(); ++i)
+                {
+                    const Piece& piece = m_pieces[i];
+                    if (piece.inBuffer != inBuffer)
+                        break;
+
+                    if (inBuffer && (piece.slot->offset == end))
+                        end += piece.slot->capacity;
+                    else if (!inBuffer && (piece.first == end))
+                        end += piece.count;
+                    else
+                    {
+                        if (inBuffer)
+                            ++m_scatteredDrawCalls;
+                        break;
+                    }
+                }
+
+                if (inBuffer)
+                    m_target->draw(m_vertexBuffer, first, end - first, states);
+                else
+                {
+                    m_target->draw(m_vertices.data() + first, end - first, sf::PrimitiveType::Triangles, states);
+                    m_uploads += end - first;
+                }
+
+                ++m_drawCalls;
+            }
+
+            m_flushedPieceCount = m_pieces.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RenderBatch::growVertexBuffer()
+        {
+            const std::size_t size = std::max(m_usedBufferSize + m_overflowSize, 2 * m_vertexBuffer.getVertexCount());
+
+            // The existing slots are copied to the new buffer on the graphics card. If that isn't possible then they are lost
+            // and their geometry is written again in the next frame.
+            sf::VertexBuffer vertexBuffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Dynamic};
+            const bool slotsKept = vertexBuffer.create(size) && (m_usedBufferSize > 0)
+                                && vertexBuffer.update(m_vertexBuffer);
+            if (!slotsKept)
+            {
+                vertexBuffer.create(size);
+                resetSlots();
+            }
+
+            m_vertexBuffer.swap(vertexBuffer);
+            m_overflowSize = 0;
+            ++m_allocations;
+
+            // The pieces that didn't fit are still in the arena, so they can be placed in the new buffer right away
+            for (auto& piece : m_pieces)
+            {
+                if (piece.written && !piece.slot->placed)
+                    uploadPiece(piece);
+            }
+        }
+    #endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,266 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RowCache.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RowCache::RowCache(std::size_t pageSize, std::size_t maxPages) :
+            m_pageSize   {std::max<std::size_t>(pageSize, 1)},
+            m_maxPages   {std::max<std::size_t>(maxPages, 1)},
+            m_fetchedRows{std::make_shared<FetchedRows>()}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RowCache::RowCache(const RowCache& other) :
+            m_dataSource  {other.m_dataSource},
+            m_rowCount    {other.m_rowCount},
+            m_pageSize    {other.m_pageSize},
+            m_maxPages    {other.m_maxPages},
+            m_pageUseOrder{other.m_pageUseOrder},
+            m_fetchedRows {std::make_shared<FetchedRows>()}
+        {
+            // The pages point into the use order, which is a different list in the copy
+            for (auto it = m_pageUseOrder.begin(); it != m_pageUseOrder.end(); ++it)
+                m_pages[*it] = {other.m_pages.at(*it).rows, it};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RowCache& RowCache::operator=(const RowCache& other)
+        {
+            if (this != &other)
+            {
+                RowCache temp(other);
+
+                std::swap(m_dataSource,   temp.m_dataSource);
+                std::swap(m_rowCount,     temp.m_rowCount);
+                std::swap(m_pageSize,     temp.m_pageSize);
+                std::swap(m_maxPages,     temp.m_maxPages);
+                std::swap(m_pages,        temp.m_pages);
+                std::swap(m_pageUseOrder, temp.m_pageUseOrder);
+                std::swap(m_pendingPages, temp.m_pendingPages);
+                std::swap(m_fetchedRows,  temp.m_fetchedRows);
+            }
+
+            return *this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RowCache::setDataSource(DataSource::Ptr dataSource)
+        {
+            m_dataSource = std::move(dataSource);
+            reset();
+            updateRowCount();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RowCache::setMaximumRows(std::size_t maxRows)
+        {
+            m_maxPages = std::max<std::size_t>((maxRows + m_pageSize - 1) / m_pageSize, 1);
+            evictPages();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t RowCache::getMaximumRows() const
+        {
+            return m_maxPages * m_pageSize;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RowCache::updateRowCount()
+        {
+            const std::size_t rowCount = m_dataSource ? m_dataSource->getRowCount() : 0;
+            if (rowCount == m_rowCount)
+                return false;
+
+            // The last page has to be fetched again when rows were added to it
+            if ((rowCount > m_rowCount) && (m_rowCount % m_pageSize != 0))
+            {
+                const auto it = m_pages.find(m_rowCount / m_pageSize);
+                if (it != m_pages.end())
+                {
+                    m_pageUseOrder.erase(it->second.usePosition);
+                    m_pages.erase(it);
+                }
+            }
+
+            m_rowCount = rowCount;
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const sf::String* RowCache::getRow(std::size_t row) const
+        {
+            if (row >= m_rowCount)
+                return nullptr;
+
+            const auto it = m_pages.find(row / m_pageSize);
+            if ((it == m_pages.end()) || (row % m_pageSize >= it->second.rows.size()))
+                return nullptr;
+
+            return &it->second.rows[row % m_pageSize];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RowCache::requestRows(std::size_t firstRow, std::size_t lastRow)
+        {
+            lastRow = std::min(lastRow, m_rowCount);
+            if (!m_dataSource || (firstRow >= lastRow))
+                return false;
+
+            // The widgets request rows around the visible ones, so the middle of a range that doesn't fit is kept
+            std::size_t firstPage = firstRow / m_pageSize;
+            std::size_t lastPage = (lastRow - 1) / m_pageSize;
+            if (lastPage - firstPage + 1 > m_maxPages)
+            {
+                const std::size_t excessPages = lastPage - firstPage + 1 - m_maxPages;
+                firstPage += excessPages / 2;
+                lastPage -= excessPages - (excessPages / 2);
+            }
+
+            bool fetching = false;
+            for (std::size_t page = firstPage; page <= lastPage; ++page)
+            {
+                const auto it = m_pages.find(page);
+                if (it != m_pages.end())
+                {
+                    m_pageUseOrder.splice(m_pageUseOrder.begin(), m_pageUseOrder, it->second.usePosition);
+                    continue;
+                }
+
+                if (m_pendingPages.find(page) != m_pendingPages.end())
+                    continue;
+
+                const std::size_t firstRowOfPage = page * m_pageSize;
+                const std::size_t rowCount = std::min(m_pageSize, m_rowCount - firstRowOfPage);
+                m_pendingPages[page] = rowCount;
+                fetching = true;
+
+                // The callback only holds a weak pointer to the queue, so it does nothing once the cache no longer needs the rows
+                const std::weak_ptr<FetchedRows> weakFetchedRows = m_fetchedRows;
+                m_dataSource->fetchRows(firstRowOfPage, rowCount,
+                    [weakFetchedRows,page](std::vector<sf::String> rows){
+                        const auto fetchedRows = weakFetchedRows.lock();
+                        if (!fetchedRows)
+                            return;
+
+                        std::lock_guard<std::mutex> lock(fetchedRows->mutex);
+                        fetchedRows->pages.emplace_back(page, std::move(rows));
+                    });
+            }
+
+            return fetching;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool RowCache::applyFetchedRows()
+        {
+            std::vector<std::pair<std::size_t, std::vector<sf::String>>> fetchedPages;
+            {
+                std::lock_guard<std::mutex> lock(m_fetchedRows->mutex);
+                fetchedPages.swap(m_fetchedRows->pages);
+            }
+
+            bool rowsAdded = false;
+            for (auto& fetchedPage : fetchedPages)
+            {
+                const std::size_t page = fetchedPage.first;
+                const auto pendingIt = m_pendingPages.find(page);
+                if (pendingIt == m_pendingPages.end())
+                    continue;
+
+                // If rows were added to the data source while the last page was being fetched then it is fetched again later
+                const std::size_t requestedRowCount = pendingIt->second;
+                m_pendingPages.erase(pendingIt);
+                if ((page * m_pageSize < m_rowCount) && (requestedRowCount < std::min(m_pageSize, m_rowCount - page * m_pageSize)))
+                    continue;
+
+                if (fetchedPage.second.size() > m_pageSize)
+                    fetchedPage.second.resize(m_pageSize);
+
+                const auto it = m_pages.find(page);
+                if (it != m_pages.end())
+                {
+                    it->second.rows = std::move(fetchedPage.second);
+                    m_pageUseOrder.splice(m_pageUseOrder.begin(), m_pageUseOrder, it->second.usePosition);
+                }
+                else
+                {
+                    m_pageUseOrder.push_front(page);
+                    m_pages[page] = {std::move(fetchedPage.second), m_pageUseOrder.begin()};
+                }
+
+                rowsAdded = true;
+            }
+
+            evictPages();
+            return rowsAdded;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RowCache::reset()
+        {
+            m_pages.clear();
+            m_pageUseOrder.clear();
+            m_pendingPages.clear();
+            m_fetchedRows = std::make_shared<FetchedRows>();
+            m_rowCount = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void RowCache::evictPages()
+        {
+            while (m_pages.size() > m_maxPages)
+            {
+                m_pages.erase(m_pageUseOrder.back());
+                m_pageUseOrder.pop_back();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,401 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/SequenceTree.hpp>
+#include <initializer_list>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        constexpr std::size_t SequenceTree::None;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<std::size_t> SequenceTree::build(const std::vector<Element>& elements)
+        {
+            clear();
+
+            std::vector<std::size_t> handles;
+            handles.reserve(elements.size());
+            m_nodes.reserve(elements.size());
+
+            // Every new node is placed on the right side of the tree. Nodes with a lower priority that were on the right side
+            // become its left subtree, their subtrees can no longer change so their totals can be calculated.
+            std::vector<std::size_t> rightSide;
+            for (const auto& element : elements)
+            {
+                const std::size_t node = createNode(element.payload, element.weight, element.counted);
+                handles.push_back(node);
+
+                std::size_t last = None;
+                while (!rightSide.empty() && (m_nodes[rightSide.back()].priority < m_nodes[node].priority))
+                {
+                    last = rightSide.back();
+                    rightSide.pop_back();
+                    updateNode(last);
+                }
+
+                m_nodes[node].left = last;
+                if (!rightSide.empty())
+                    m_nodes[rightSide.back()].right = node;
+
+                rightSide.push_back(node);
+            }
+
+            for (auto it = rightSide.rbegin(); it != rightSide.rend(); ++it)
+                updateNode(*it);
+
+            if (!rightSide.empty())
+            {
+                m_root = rightSide.front();
+                m_nodes[m_root].parent = None;
+            }
+
+            return handles;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SequenceTree::clear()
+        {
+            m_nodes.clear();
+            m_freeNodes.clear();
+            m_root = None;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::insert(std::size_t position, std::size_t payload, unsigned int weight, bool counted)
+        {
+            const std::size_t node = createNode(payload, weight, counted);
+            updateNode(node);
+
+            std::size_t first;
+            std::size_t second;
+            split(m_root, position, first, second);
+            m_root = merge(merge(first, node), second);
+            m_nodes[m_root].parent = None;
+            return node;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SequenceTree::erase(std::size_t handle)
+        {
+            std::size_t first;
+            std::size_t rest;
+            std::size_t node;
+            std::size_t last;
+            split(m_root, getPosition(handle), first, rest);
+            split(rest, 1, node, last);
+
+            m_root = merge(first, last);
+            if (m_root != None)
+                m_nodes[m_root].parent = None;
+
+            m_freeNodes.push_back(handle);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<std::size_t> SequenceTree::getHandles() const
+        {
+            std::vector<std::size_t> handles;
+            handles.reserve(getSize());
+
+            // In-order traversal without recursion
+            std::vector<std::size_t> path;
+            std::size_t node = m_root;
+            while ((node != None) || !path.empty())
+            {
+                while (node != None)
+                {
+                    path.push_back(node);
+                    node = m_nodes[node].left;
+                }
+
+                node = path.back();
+                path.pop_back();
+                handles.push_back(node);
+                node = m_nodes[node].right;
+            }
+
+            return handles;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::at(std::size_t position) const
+        {
+            std::size_t node = m_root;
+            while (true)
+            {
+                const std::size_t leftSize = getSize(m_nodes[node].left);
+                if (position < leftSize)
+                    node = m_nodes[node].left;
+                else if (position == leftSize)
+                    return node;
+                else
+                {
+                    position -= leftSize + 1;
+                    node = m_nodes[node].right;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::atCounted(std::size_t countedPosition) const
+        {
+            std::size_t node = m_root;
+            while (true)
+            {
+                const std::size_t left = m_nodes[node].left;
+                const std::size_t leftCount = (left != None) ? m_nodes[left].countedSize : 0;
+                if (countedPosition < leftCount)
+                    node = left;
+                else if ((countedPosition == leftCount) && m_nodes[node].counted)
+                    return node;
+                else
+                {
+                    countedPosition -= leftCount + (m_nodes[node].counted ? 1 : 0);
+                    node = m_nodes[node].right;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::getPosition(std::size_t handle) const
+        {
+            std::size_t position = getSize(m_nodes[handle].left);
+            for (std::size_t node = handle; m_nodes[node].parent != None; node = m_nodes[node].parent)
+            {
+                const std::size_t parent = m_nodes[node].parent;
+                if (m_nodes[parent].right == node)
+                    position += getSize(m_nodes[parent].left) + 1;
+            }
+
+            return position;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::getCountedPosition(std::size_t handle) const
+        {
+            const auto countedSize = [this](std::size_t node){ return (node != None) ? m_nodes[node].countedSize : 0; };
+
+            std::size_t position = countedSize(m_nodes[handle].left);
+            for (std::size_t node = handle; m_nodes[node].parent != None; node = m_nodes[node].parent)
+            {
+                const std::size_t parent = m_nodes[node].parent;
+                if (m_nodes[parent].right == node)
+                    position += countedSize(m_nodes[parent].left) + (m_nodes[parent].counted ? 1 : 0);
+            }
+
+            return position;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int SequenceTree::getCountedWeightBefore(std::size_t count) const
+        {
+            unsigned int weight = 0;
+            std::size_t node = m_root;
+            while ((node != None) && (count > 0))
+            {
+                const std::size_t left = m_nodes[node].left;
+                const std::size_t leftCount = (left != None) ? m_nodes[left].countedSize : 0;
+                if (count <= leftCount)
+                    node = left;
+                else
+                {
+                    if (left != None)
+                        weight += m_nodes[left].countedWeight;
+
+                    count -= leftCount;
+                    if (m_nodes[node].counted)
+                    {
+                        weight += m_nodes[node].weight;
+                        --count;
+                    }
+
+                    node = m_nodes[node].right;
+                }
+            }
+
+            return weight;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::findCountedAtWeight(unsigned int offset) const
+        {
+            std::size_t count = 0;
+            std::size_t node = m_root;
+            while (node != None)
+            {
+                const std::size_t left = m_nodes[node].left;
+                const unsigned int leftWeight = (left != None) ? m_nodes[left].countedWeight : 0;
+                if (offset < leftWeight)
+                {
+                    node = left;
+                    continue;
+                }
+
+                offset -= leftWeight;
+                count += (left != None) ? m_nodes[left].countedSize : 0;
+                if (m_nodes[node].counted)
+                {
+                    // The element that contains the offset was found
+                    if (offset < m_nodes[node].weight)
+                        return count;
+
+                    offset -= m_nodes[node].weight;
+                    ++count;
+                }
+
+                node = m_nodes[node].right;
+            }
+
+            return count;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SequenceTree::setWeight(std::size_t handle, unsigned int weight, bool counted)
+        {
+            m_nodes[handle].weight = weight;
+            m_nodes[handle].counted = counted;
+
+            for (std::size_t node = handle; node != None; node = m_nodes[node].parent)
+                updateNode(node);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::createNode(std::size_t payload, unsigned int weight, bool counted)
+        {
+            // Xorshift generator, the priorities only have to be spread out evenly
+            m_random ^= m_random << 13;
+            m_random ^= m_random >> 17;
+            m_random ^= m_random << 5;
+
+            const Node node{None, None, None, m_random, payload, weight, counted, 1, counted ? 1u : 0u, counted ? weight : 0};
+            if (!m_freeNodes.empty())
+            {
+                const std::size_t handle = m_freeNodes.back();
+                m_freeNodes.pop_back();
+                m_nodes[handle] = node;
+                return handle;
+            }
+
+            m_nodes.push_back(node);
+            return m_nodes.size() - 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SequenceTree::updateNode(std::size_t node)
+        {
+            Node& n = m_nodes[node];
+            n.size = 1;
+            n.countedSize = n.counted ? 1 : 0;
+            n.countedWeight = n.counted ? n.weight : 0;
+
+            for (const std::size_t child : {n.left, n.right})
+            {
+                if (child == None)
+                    continue;
+
+                m_nodes[child].parent = node;
+                n.size += m_nodes[child].size;
+                n.countedSize += m_nodes[child].countedSize;
+                n.countedWeight += m_nodes[child].countedWeight;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SequenceTree::split(std::size_t node, std::size_t count, std::size_t& first, std::size_t& second)
+        {
+            if (node == None)
+            {
+                first = None;
+                second = None;
+                return;
+            }
+
+            const std::size_t leftSize = getSize(m_nodes[node].left);
+            if (count <= leftSize)
+            {
+                split(m_nodes[node].left, count, first, m_nodes[node].left);
+                second = node;
+            }
+            else
+            {
+                split(m_nodes[node].right, count - leftSize - 1, m_nodes[node].right, second);
+                first = node;
+            }
+
+            updateNode(node);
+            if (first != None)
+                m_nodes[first].parent = None;
+            if (second != None)
+                m_nodes[second].parent = None;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SequenceTree::merge(std::size_t first, std::size_t second)
+        {
+            if (first == None)
+                return second;
+            if (second == None)
+                return first;
+
+            if (m_nodes[first].priority > m_nodes[second].priority)
+            {
+                m_nodes[first].right = merge(m_nodes[first].right, second);
+                updateNode(first);
+                return first;
+            }
+            else
+            {
+                m_nodes[second].left = merge(first, m_nodes[second].left);
+                updateNode(second);
+                return second;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,48 +25,100 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/FontCache.hpp>
+#include <TGUI/WordWrapper.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <vector>
+#include <tuple>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Reused when drawing a text without render batch, to avoid allocating memory for every draw
+        std::vector<sf::Vertex> coloredVertices;
+
+        const std::size_t maxBestTextSizes = 1024;
+        priv::FontCache<std::tuple<const sf::Font*, float, int>, unsigned int> bestTextSizes;
+
+        unsigned int findBestTextSizeUncached(const std::shared_ptr<sf::Font>& font, float height, int fit)
+        {
+            std::vector<unsigned int> textSizes(static_cast<std::size_t>(height));
+            for (unsigned int i = 0; i < static_cast<unsigned int>(height); ++i)
+                textSizes[i] = i + 1;
+
+            const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
+                                               [&](unsigned int charSize, float h) { return font->getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
+            if (high == textSizes.end())
+                return static_cast<unsigned int>(height);
+
+            const float highLineSpacing = font->getLineSpacing(*high);
+            if (highLineSpacing == height)
+                return *high;
+
+            const auto low = high - 1;
+            const float lowLineSpacing = font->getLineSpacing(*low);
+
+            if (fit < 0)
+                return *low;
+            else if (fit > 0)
+                return *high;
+            else
+            {
+                if (std::abs(height - lowLineSpacing) < std::abs(height - highLineSpacing))
+                    return *low;
+                else
+                    return *high;
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::Vector2f Text::getSize() const
     {
-        return m_size;
+        const priv::TextLayout* layout = getLayout();
+        if (layout)
+            return layout->getSize();
+        else
+            return {0, 0};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setString(const sf::String& string)
     {
-        m_text.setString(string);
-        recalculateSize();
+        m_string = string;
+        m_layout = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& Text::getString() const
     {
-        return m_text.getString();
+        return m_string;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setCharacterSize(unsigned int size)
     {
-        m_text.setCharacterSize(size);
-        recalculateSize();
+        m_characterSize = size;
+        m_layout = nullptr;
+        m_metrics = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Text::getCharacterSize() const
     {
-        return m_text.getCharacterSize();
+        return m_characterSize;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,12 +126,6 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
-    #endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,12 +140,6 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
-    #endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,28 +154,8 @@ namespace tgui
     void Text::setFont(Font font)
     {
         m_font = font;
-
-        if (font)
-            m_text.setFont(*font.getFont());
-        else
-        {
-            // We can't keep using a pointer to the old font (it might be destroyed), but sf::Text has no function to pass an empty font
-            if (m_text.getFont())
-            {
-                m_text = {};
-                m_text.setString(getString());
-                m_text.setCharacterSize(getCharacterSize());
-                m_text.setStyle(getStyle());
-
-            #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-                m_text.setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
-            #else
-                m_text.setColor(Color::calcColorOpacity(getColor(), getOpacity()));
-            #endif
-            }
-        }
-
-        recalculateSize();
+        m_layout = nullptr;
+        m_metrics = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,10 +169,11 @@ namespace tgui
 
     void Text::setStyle(TextStyle style)
     {
-        if (style != m_text.getStyle())
+        if (style != m_style)
         {
-            m_text.setStyle(style);
-            recalculateSize();
+            m_style = style;
+            m_layout = nullptr;
+            m_metrics = nullptr;
         }
     }
 
@@ -160,68 +181,131 @@ namespace tgui
 
     TextStyle Text::getStyle() const
     {
-        return m_text.getStyle();
+        return m_style;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        if (m_font == nullptr)
+            return {0, 0};
+
+        // The metrics are scaled when distance field rendering is enabled, so this also works when the glyphs aren't rendered at the character size
+        const sf::String& string = m_string;
+        if (index > string.getSize())
+            index = string.getSize();
+
+        priv::GlyphMetrics& metrics = getMetrics();
+
+        sf::Vector2f position;
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const sf::Uint32 curChar = string[i];
+            position.x += metrics.getKerning(prevChar, curChar);
+            prevChar = curChar;
+
+            if (curChar == '\n')
+            {
+                position.y += metrics.getLineSpacing();
+                position.x = 0;
+            }
+            else
+                position.x += metrics.getAdvance(curChar);
+        }
+
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        states.transform *= getTransform();
+        const priv::TextLayout* layout = getLayout();
+        if (!layout)
+            return;
+
+        const std::shared_ptr<sf::Font> font = m_font;
+        const std::vector<sf::Vertex>& vertices = layout->getVertices(*font);
+        if (vertices.empty())
+            return;
+
+        states.transform = roundPosition(states.transform * getTransform());
+        selectTexture(states, *layout, *font, m_characterSize);
 
-        // Round the position to avoid blurry text
-        const float* matrix = states.transform.getMatrix();
-        states.transform = sf::Transform{matrix[0], matrix[4], std::round(matrix[12]),
-                                         matrix[1], matrix[5], std::floor(matrix[13]),
-                                         matrix[3], matrix[7], matrix[15]};
+        // The shared vertices are white, they get the color of this text while they are copied
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+        priv::RenderBatch* batch = priv::RenderBatch::getActive(target);
+        if (batch)
+            batch->addTriangles(vertices.data(), vertices.size(), states, color, layout->getVersion());
+        else
+        {
+            if (vertices.size() > coloredVertices.capacity())
+                priv::RenderBatch::countAllocation();
 
-        target.draw(m_text, states);
+            coloredVertices.assign(vertices.begin(), vertices.end());
+            for (auto& vertex : coloredVertices)
+                vertex.color = color;
+
+            target.draw(coloredVertices.data(), coloredVertices.size(), sf::PrimitiveType::Triangles, states);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Text::recalculateSize()
+    const priv::TextLayout* Text::getLayout() const
     {
-        const std::shared_ptr<sf::Font> font = m_font;
-        if (font == nullptr)
+        // The layout is also looked up again when the rendering mode changed since it was created
+        if (!m_layout || ((m_layout->getDistanceField() != nullptr) != priv::DistanceFieldFont::isEnabled()))
         {
-            m_size = {0, 0};
-            return;
+            const std::shared_ptr<sf::Font> font = m_font;
+            if (font == nullptr)
+                return nullptr;
+
+            m_layout = TextLayoutCache::getLayout(font, m_string, m_characterSize, m_style);
         }
 
-        float width = 0;
-        float maxWidth = 0;
-        unsigned int lines = 1;
-        sf::Uint32 prevChar = 0;
-        const sf::String& string = m_text.getString();
-        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
-        for (std::size_t i = 0; i < string.getSize(); ++i)
-        {
-            const float kerning = static_cast<float>(font->getKerning(prevChar, string[i], textSize));
-            if (string[i] == '\n')
-            {
-                maxWidth = std::max(maxWidth, width);
-                width = 0;
-                lines++;
-            }
-            else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
-            else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+        return m_layout.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            prevChar = string[i];
+    priv::GlyphMetrics& Text::getMetrics() const
+    {
+        // Text drawn from distance fields has different metrics, so they are also looked up again when the rendering mode changed
+        if (!m_metrics || (m_metricsDistanceField != priv::DistanceFieldFont::isEnabled()))
+        {
+            const bool bold = (m_style & sf::Text::Bold) != 0;
+            m_metrics = &priv::GlyphMetrics::get(m_font.getFont(), m_characterSize, bold);
+            m_metricsDistanceField = priv::DistanceFieldFont::isEnabled();
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        m_size = {std::max(maxWidth, width), lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace};
+        return *m_metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Transform Text::roundPosition(const sf::Transform& transform)
+    {
+        const float* matrix = transform.getMatrix();
+        return {matrix[0], matrix[4], std::round(matrix[12]),
+                matrix[1], matrix[5], std::floor(matrix[13]),
+                matrix[3], matrix[7], matrix[15]};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::selectTexture(sf::RenderStates& states, const priv::TextLayout& layout, sf::Font& font, unsigned int characterSize)
+    {
+        priv::DistanceFieldFont* distanceField = layout.getDistanceField();
+        if (distanceField)
+        {
+            states.texture = &distanceField->getTexture();
+            states.shader = priv::DistanceFieldFont::getShader();
+        }
+        else
+            states.texture = &font.getTexture(characterSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,33 +319,41 @@ namespace tgui
         if (height < 2)
             return 1;
 
-        std::vector<unsigned int> textSizes(static_cast<std::size_t>(height));
-        for (unsigned int i = 0; i < static_cast<unsigned int>(height); ++i)
-            textSizes[i] = i + 1;
+        const auto key = std::make_tuple(font.get(), height, fit);
+        const unsigned int* cachedTextSize = bestTextSizes.find(key, font);
+        if (cachedTextSize)
+            return *cachedTextSize;
 
-        const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
-                                           [&](unsigned int charSize, float h) { return font->getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
-        if (high == textSizes.end())
-            return static_cast<unsigned int>(height);
+        // Animations can produce a lot of different heights, so the cache is emptied when it becomes too large
+        if (bestTextSizes.getSize() >= maxBestTextSizes)
+            bestTextSizes.clear();
 
-        const float highLineSpacing = font->getLineSpacing(*high);
-        if (highLineSpacing == height)
-            return *high;
+        return bestTextSizes.insert(key, font, findBestTextSizeUncached(font, height, fit));
+    }
 
-        const auto low = high - 1;
-        const float lowLineSpacing = font->getLineSpacing(*low);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (fit < 0)
-            return *low;
-        else if (fit > 0)
-            return *high;
-        else
-        {
-            if (std::abs(height - lowLineSpacing) < std::abs(height - highLineSpacing))
-                return *low;
-            else
-                return *high;
-        }
+    void Text::clearBestTextSizeCache()
+    {
+        bestTextSizes.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::setDistanceFieldRendering(bool enabled)
+    {
+        priv::DistanceFieldFont::setEnabled(enabled);
+
+        // The measured sizes depend on the rendering mode
+        bestTextSizes.clear();
+        TextLayoutCache::clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Text::getDistanceFieldRendering()
+    {
+        return priv::DistanceFieldFont::isEnabled();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -272,17 +364,7 @@ namespace tgui
             return 0;
 
         const bool bold = (style & sf::Text::Bold) != 0;
-
-        // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
-
-        // Get the line spacing sfml returns
-        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
-
-        // Calculate the offset of the text
-        return lineHeight - lineSpacing;
+        return priv::GlyphMetrics::get(font.getFont(), characterSize, bold).getExtraVerticalSpace();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -292,81 +374,20 @@ namespace tgui
         if (font == nullptr)
             return "";
 
+        priv::WordWrapper wordWrapper;
+        wordWrapper.setFont(font, textSize, bold);
+        wordWrapper.setDropLeadingSpace(dropLeadingSpace);
+        wordWrapper.setMaximumWidth(maxWidth);
+        wordWrapper.setText(text);
+
         sf::String result;
-        std::size_t index = 0;
-        while (index < text.getSize())
+        const auto& lines = wordWrapper.getLines();
+        for (std::size_t i = 0; i < lines.size(); ++i)
         {
-            const std::size_t oldIndex = index;
-
-            // Find out how many characters we can get on this line
-            float width = 0;
-            sf::Uint32 prevChar = 0;
-            for (std::size_t i = index; i < text.getSize(); ++i)
-            {
-                float charWidth;
-                const sf::Uint32 curChar = text[i];
-                if (curChar == '\n')
-                {
-                    index++;
-                    break;
-                }
-                else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
-
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
-                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
-                {
-                    width += kerning + charWidth;
-                    index++;
-                }
-                else
-                    break;
-
-                prevChar = curChar;
-            }
-
-            // Every line contains at least one character
-            if (index == oldIndex)
-                index++;
-
-            // Implement the word-wrap by removing the last few characters from the line
-            if (text[index-1] != '\n')
-            {
-                const std::size_t indexWithoutWordWrap = index;
-                if ((index < text.getSize()) && (!isWhitespace(text[index])))
-                {
-                    std::size_t wordWrapCorrection = 0;
-                    while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
-                    {
-                        wordWrapCorrection++;
-                        index--;
-                    }
-
-                    // The word can't be split but there is no other choice, it does not fit on the line
-                    if ((index - oldIndex) <= wordWrapCorrection)
-                        index = indexWithoutWordWrap;
-                }
-            }
-
-            // If the next line starts with just a space, then the space need not be visible
-            if (dropLeadingSpace)
-            {
-                if ((index < text.getSize()) && (text[index] == ' '))
-                {
-                    if ((index == 0) || (!isWhitespace(text[index-1])))
-                    {
-                        // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
-                        if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
-                            index++;
-                    }
-                }
-            }
+            if (i > 0)
+                result += '\n';
 
-            result += text.substring(oldIndex, index - oldIndex);
-            if ((index < text.getSize()) && (text[index-1] != '\n'))
-                result += "\n";
+            result += text.substring(lines[i].begin, lines[i].end - lines[i].begin);
         }
 
         return result;
@@ -0,0 +1,399 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TextLayoutCache.hpp>
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <list>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        using LayoutList = std::list<std::shared_ptr<priv::TextLayout>>;
+
+        // The most recently used layouts are in front of the list, the map finds them based on the hash of their string
+        LayoutList cachedLayouts;
+        std::unordered_multimap<std::size_t, LayoutList::iterator> cachedLayoutsByHash;
+
+        std::size_t memoryBudget = 4 * 1024 * 1024;
+        std::size_t memoryUsage = 0;
+        std::size_t hitCount = 0;
+        std::size_t missCount = 0;
+
+        std::size_t hashString(const sf::String& string)
+        {
+            // FNV-1a
+            std::size_t hash = 2166136261u;
+            const sf::Uint32* const characters = string.getData();
+            for (std::size_t i = 0; i < string.getSize(); ++i)
+            {
+                hash ^= characters[i];
+                hash *= 16777619u;
+            }
+
+            return hash;
+        }
+
+        void removeLayout(std::size_t hash, LayoutList::iterator layoutIt)
+        {
+            const auto range = cachedLayoutsByHash.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == layoutIt)
+                {
+                    cachedLayoutsByHash.erase(it);
+                    break;
+                }
+            }
+
+            memoryUsage -= (*layoutIt)->getMemoryEstimate();
+            cachedLayouts.erase(layoutIt);
+        }
+
+        void removeLeastRecentlyUsedLayouts()
+        {
+            while ((memoryUsage > memoryBudget) && !cachedLayouts.empty())
+            {
+                const auto layoutIt = std::prev(cachedLayouts.end());
+                removeLayout(hashString((*layoutIt)->getString()), layoutIt);
+            }
+        }
+    }
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextLayout::TextLayout(const std::shared_ptr<sf::Font>& font, const sf::String& string, unsigned int characterSize, TextStyle style) :
+            m_font         {font},
+            m_string       {string},
+            m_characterSize{characterSize},
+            m_style        {style},
+            m_version      {RenderBatch::createGeometryVersion()}
+        {
+            const bool bold = (style & sf::Text::Bold) != 0;
+            GlyphMetrics& metrics = GlyphMetrics::get(font, characterSize, bold);
+
+            if (DistanceFieldFont::isEnabled())
+                m_distanceField = &DistanceFieldFont::get(font, bold);
+
+            // The width of every line is calculated separately, the kerning with the newline character is included like sf::Text does
+            float maxWidth = 0;
+            unsigned int lines = 1;
+            sf::Uint32 prevChar = 0;
+            std::size_t lineStart = 0;
+            const sf::Uint32* const characters = string.getData();
+            for (std::size_t i = 0; i < string.getSize(); ++i)
+            {
+                if (characters[i] == '\n')
+                {
+                    maxWidth = std::max(maxWidth, metrics.getLineWidth(characters + lineStart, i - lineStart, prevChar));
+                    prevChar = '\n';
+                    lineStart = i + 1;
+                    lines++;
+                }
+            }
+
+            maxWidth = std::max(maxWidth, metrics.getLineWidth(characters + lineStart, string.getSize() - lineStart, prevChar));
+            m_size = {maxWidth, lines * metrics.getLineSpacing() + metrics.getExtraVerticalSpace()};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::vector<sf::Vertex>& TextLayout::getVertices(const sf::Font& font) const
+        {
+            if (m_verticesCreated || m_string.isEmpty())
+                return m_vertices;
+
+            m_verticesCreated = true;
+
+            const sf::String& string = m_string;
+            const sf::Uint32 style = m_style;
+            const bool bold = (style & sf::Text::Bold) != 0;
+            const bool underlined = (style & sf::Text::Underlined) != 0;
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            const bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        #else
+            const bool strikeThrough = false;
+        #endif
+            const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees
+
+            // Since SFML 2.5 the glyph bounds no longer include the padding around the glyph in the font texture
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            const float padding = 1;
+        #else
+            const float padding = 0;
+        #endif
+
+            const unsigned int characterSize = m_characterSize;
+            const sf::Color color = sf::Color::White;
+            const float underlineOffset = font.getUnderlinePosition(characterSize);
+            const float lineThickness = font.getUnderlineThickness(characterSize);
+            const float lineSpacing = static_cast<float>(font.getLineSpacing(characterSize));
+
+            // With distance fields, the glyphs are scaled from the base size so that sf::Font doesn't render the glyphs again
+            const float scale = static_cast<float>(characterSize) / DistanceFieldFont::BaseCharacterSize;
+            const sf::FloatRect xBounds = m_distanceField ? m_distanceField->getGlyph(U'x').bounds : font.getGlyph(U'x', characterSize, bold).bounds;
+            const float strikeThroughOffset = m_distanceField ? (xBounds.top + (xBounds.height / 2.f)) * scale : xBounds.top + (xBounds.height / 2.f);
+            const float whitespaceWidth = m_distanceField ? m_distanceField->getGlyph(U' ').advance * scale
+                                                          : static_cast<float>(font.getGlyph(U' ', characterSize, bold).advance);
+
+            // The lines use the white pixel that is always present in the top left corner of the font texture (or the atlas)
+            const auto addLine = [&](float lineLength, float lineTop, float offset){
+                const float top = std::floor(lineTop + offset - (lineThickness / 2) + 0.5f);
+                const float bottom = top + std::floor(lineThickness + 0.5f);
+                m_vertices.emplace_back(sf::Vector2f{0, top}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{lineLength, bottom}, color, sf::Vector2f{1, 1});
+            };
+
+            m_vertices.reserve(6 * string.getSize());
+
+            float x = 0;
+            float y = static_cast<float>(characterSize);
+            sf::Uint32 prevChar = 0;
+            for (std::size_t i = 0; i < string.getSize(); ++i)
+            {
+                const sf::Uint32 curChar = string[i];
+                if (curChar == U'\r')
+                    continue;
+
+                if (m_distanceField)
+                    x += m_distanceField->getKerning(prevChar, curChar) * scale;
+                else
+                    x += static_cast<float>(font.getKerning(prevChar, curChar, characterSize));
+
+                if ((curChar == U'\n') && (prevChar != U'\n'))
+                {
+                    if (underlined)
+                        addLine(x, y, underlineOffset);
+                    if (strikeThrough)
+                        addLine(x, y, strikeThroughOffset);
+                }
+
+                prevChar = curChar;
+
+                if (curChar == U' ')
+                {
+                    x += whitespaceWidth;
+                    continue;
+                }
+                else if (curChar == U'\t')
+                {
+                    x += whitespaceWidth * 4;
+                    continue;
+                }
+                else if (curChar == U'\n')
+                {
+                    y += lineSpacing;
+                    x = 0;
+                    continue;
+                }
+
+                float left, top, right, bottom;
+                float u1, v1, u2, v2;
+                float advance;
+                if (m_distanceField)
+                {
+                    const DistanceFieldFont::Glyph& glyph = m_distanceField->getGlyph(curChar);
+                    advance = glyph.advance * scale;
+                    if (glyph.textureRect.width == 0)
+                    {
+                        x += advance;
+                        continue;
+                    }
+
+                    // The quad also covers the spread around the glyph, where the shader makes the edge smooth
+                    const float spread = static_cast<float>(DistanceFieldFont::Spread);
+                    left = (glyph.bounds.left - spread) * scale;
+                    top = (glyph.bounds.top - spread) * scale;
+                    right = (glyph.bounds.left + glyph.bounds.width + spread) * scale;
+                    bottom = (glyph.bounds.top + glyph.bounds.height + spread) * scale;
+
+                    u1 = static_cast<float>(glyph.textureRect.left);
+                    v1 = static_cast<float>(glyph.textureRect.top);
+                    u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+                    v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+                }
+                else
+                {
+                    const sf::Glyph& glyph = font.getGlyph(curChar, characterSize, bold);
+                    advance = static_cast<float>(glyph.advance);
+
+                    left = glyph.bounds.left - padding;
+                    top = glyph.bounds.top - padding;
+                    right = glyph.bounds.left + glyph.bounds.width + padding;
+                    bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+                    u1 = static_cast<float>(glyph.textureRect.left) - padding;
+                    v1 = static_cast<float>(glyph.textureRect.top) - padding;
+                    u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+                    v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+                }
+
+                m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * top, y + top}, color, sf::Vector2f{u1, v1});
+                m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * top, y + top}, color, sf::Vector2f{u2, v1});
+                m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+                m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+                m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * top, y + top}, color, sf::Vector2f{u2, v1});
+                m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * bottom, y + bottom}, color, sf::Vector2f{u2, v2});
+
+                x += advance;
+            }
+
+            if (x > 0)
+            {
+                if (underlined)
+                    addLine(x, y, underlineOffset);
+                if (strikeThrough)
+                    addLine(x, y, strikeThroughOffset);
+            }
+
+            return m_vertices;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool TextLayout::matches(const std::shared_ptr<sf::Font>& font, const sf::String& string, unsigned int characterSize, TextStyle style) const
+        {
+            return (m_characterSize == characterSize) && (m_style == style) && ((m_distanceField != nullptr) == DistanceFieldFont::isEnabled())
+                && (m_font.lock() == font) && (m_string == string);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextLayout::getMemoryEstimate() const
+        {
+            // The vertices are only created when the text is drawn, so 6 vertices per character are assumed
+            return sizeof(TextLayout) + (m_string.getSize() * (sizeof(sf::Uint32) + 6 * sizeof(sf::Vertex)));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutCache::setMemoryBudget(std::size_t bytes)
+    {
+        memoryBudget = bytes;
+        removeLeastRecentlyUsedLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLayoutCache::getMemoryBudget()
+    {
+        return memoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLayoutCache::getMemoryUsage()
+    {
+        return memoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLayoutCache::getHitCount()
+    {
+        return hitCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextLayoutCache::getMissCount()
+    {
+        return missCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutCache::resetStatistics()
+    {
+        hitCount = 0;
+        missCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextLayoutCache::clear()
+    {
+        cachedLayouts.clear();
+        cachedLayoutsByHash.clear();
+        memoryUsage = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const priv::TextLayout> TextLayoutCache::getLayout(const std::shared_ptr<sf::Font>& font, const sf::String& string,
+                                                                       unsigned int characterSize, TextStyle style)
+    {
+        const std::size_t hash = hashString(string);
+        const auto range = cachedLayoutsByHash.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            const LayoutList::iterator layoutIt = it->second;
+            if ((*layoutIt)->matches(font, string, characterSize, style))
+            {
+                ++hitCount;
+
+                // Move the layout to the front of the list as it is now the most recently used one
+                cachedLayouts.splice(cachedLayouts.begin(), cachedLayouts, layoutIt);
+                return *layoutIt;
+            }
+        }
+
+        ++missCount;
+        auto layout = std::make_shared<priv::TextLayout>(font, string, characterSize, style);
+
+        const std::size_t memory = layout->getMemoryEstimate();
+        if (memory <= memoryBudget)
+        {
+            cachedLayouts.push_front(layout);
+            cachedLayoutsByHash.insert({hash, cachedLayouts.begin()});
+            memoryUsage += memory;
+            removeLeastRecentlyUsedLayouts();
+        }
+
+        return layout;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,214 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TextRelayoutPass.hpp>
+#include <TGUI/WordWrapper.hpp>
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/WorkerPool.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct WrapJob
+        {
+            priv::WordWrapper* wordWrapper;
+            std::function<void()> onWrapped;
+        };
+
+        unsigned int passDepth = 0;
+
+        std::vector<WrapJob> queuedJobs;
+        std::vector<WrapJob> runningJobs; // Jobs of which the lines are being calculated or the callbacks are being called
+
+        // The word wrapper remembers the index of its job, which stays the same when the queued jobs start running
+        WrapJob* findJob(const priv::WordWrapper& wordWrapper, std::size_t index)
+        {
+            if ((index < queuedJobs.size()) && (queuedJobs[index].wordWrapper == &wordWrapper))
+                return &queuedJobs[index];
+            if ((index < runningJobs.size()) && (runningJobs[index].wordWrapper == &wordWrapper))
+                return &runningJobs[index];
+
+            return nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRelayoutPass::Scope::Scope()
+    {
+        TextRelayoutPass::begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRelayoutPass::Scope::~Scope()
+    {
+        TextRelayoutPass::end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextRelayoutPass::isActive()
+    {
+        return passDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRelayoutPass::setThreadCount(unsigned int threadCount)
+    {
+        priv::WorkerPool::setThreadCount(threadCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextRelayoutPass::getThreadCount()
+    {
+        return priv::WorkerPool::getThreadCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRelayoutPass::cancel(const priv::WordWrapper& wordWrapper)
+    {
+        // The job isn't removed from the list, as we might be looping over it
+        WrapJob* job = findJob(wordWrapper, wordWrapper.m_relayoutJob);
+        if (job)
+        {
+            job->wordWrapper = nullptr;
+            job->onWrapped = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRelayoutPass::parallelFor(std::size_t count, std::size_t characterCount, const std::function<void(std::size_t)>& function,
+                                       const std::function<void(std::size_t)>& prepare)
+    {
+        if (!priv::WorkerPool::isWorthUsingThreads(count, characterCount))
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                function(i);
+
+            return;
+        }
+
+        // Fonts can only be used on this thread, the workers only read the metrics that are loaded here
+        if (prepare)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                prepare(i);
+        }
+
+        priv::GlyphMetrics::setReadOnly(true);
+        priv::WorkerPool::parallelFor(count, characterCount, function);
+        priv::GlyphMetrics::setReadOnly(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRelayoutPass::begin()
+    {
+        ++passDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRelayoutPass::end()
+    {
+        if (--passDepth > 0)
+            return;
+
+        // The callbacks may resize other widgets, the requests that this causes are handled in the next round
+        passDepth = 1;
+        while (!queuedJobs.empty())
+        {
+            runningJobs.swap(queuedJobs);
+
+            std::size_t characterCount = 0;
+            for (const auto& job : runningJobs)
+                characterCount += job.wordWrapper ? job.wordWrapper->getText().getSize() : 0;
+
+            // Calculate the lines of all texts. Every word wrapper is only accessed by a single thread.
+            const auto wrap = [](std::size_t i){
+                if (runningJobs[i].wordWrapper)
+                    runningJobs[i].wordWrapper->getLines();
+            };
+
+            const auto preload = [](std::size_t i){
+                if (runningJobs[i].wordWrapper)
+                    runningJobs[i].wordWrapper->preloadGlyphs();
+            };
+
+            parallelFor(runningJobs.size(), characterCount, wrap, preload);
+
+            // Let the widgets use the lines, in the same order as they were requested
+            for (std::size_t i = 0; i < runningJobs.size(); ++i)
+            {
+                if (!runningJobs[i].wordWrapper)
+                    continue;
+
+                const auto onWrapped = std::move(runningJobs[i].onWrapped);
+                runningJobs[i].wordWrapper->m_relayoutQueued = false;
+                runningJobs[i].wordWrapper = nullptr;
+
+                onWrapped();
+            }
+
+            runningJobs.clear();
+        }
+
+        passDepth = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRelayoutPass::queue(priv::WordWrapper& wordWrapper, std::function<void()> onWrapped)
+    {
+        if (wordWrapper.m_relayoutQueued)
+        {
+            // Only the last request matters, but the word wrapper keeps its place in the queue
+            WrapJob* job = findJob(wordWrapper, wordWrapper.m_relayoutJob);
+            if (job)
+            {
+                job->onWrapped = std::move(onWrapped);
+                return;
+            }
+        }
+
+        wordWrapper.m_relayoutQueued = true;
+        wordWrapper.m_relayoutJob = queuedJobs.size();
+        queuedJobs.push_back({&wordWrapper, std::move(onWrapped)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
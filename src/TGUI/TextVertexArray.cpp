@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextVertexArray.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        void TextVertexArray::clear()
+        {
+            m_vertices.clear();
+            m_lines.clear();
+            m_transformedVertices.clear();
+            m_transformedVerticesValid = false;
+            m_layout = nullptr;
+            m_font = nullptr;
+            m_characterSize = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextVertexArray::addText(const Text& text)
+        {
+            const TextLayout* layout = text.getLayout();
+            if (!layout)
+                return;
+
+            const std::shared_ptr<sf::Font> font = text.m_font;
+            const std::vector<sf::Vertex>& vertices = layout->getVertices(*font);
+            if (vertices.empty())
+                return;
+
+            if (!m_layout)
+            {
+                m_layout = text.m_layout;
+                m_font = text.m_font;
+                m_characterSize = text.m_characterSize;
+            }
+
+            const sf::Color color = Color::calcColorOpacity(text.m_color, text.m_opacity);
+
+            m_vertices.reserve(m_vertices.size() + vertices.size());
+            for (const auto& vertex : vertices)
+                m_vertices.emplace_back(vertex.position, color, vertex.texCoords);
+
+            m_lines.push_back({text.getTransform(), vertices.size()});
+            m_transformedVerticesValid = false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextVertexArray::setColor(sf::Color color)
+        {
+            for (auto& vertex : m_vertices)
+                vertex.color = color;
+
+            m_transformedVerticesValid = false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextVertexArray::draw(sf::RenderTarget& target, sf::RenderStates states) const
+        {
+            if (m_vertices.empty())
+                return;
+
+            // Each text is rounded separately after being combined with the transform of the widget, which is only redone
+            // when the widget was moved or when the texts changed
+            const float* matrix = states.transform.getMatrix();
+            if (!m_transformedVerticesValid || !std::equal(matrix, matrix + 16, m_transform.getMatrix()))
+            {
+                m_transformedVertices.resize(m_vertices.size());
+
+                std::size_t vertexIndex = 0;
+                for (const auto& line : m_lines)
+                {
+                    const sf::Transform transform = Text::roundPosition(states.transform * line.transform);
+                    for (std::size_t i = vertexIndex; i < vertexIndex + line.vertexCount; ++i)
+                    {
+                        m_transformedVertices[i] = m_vertices[i];
+                        m_transformedVertices[i].position = transform.transformPoint(m_vertices[i].position);
+                    }
+
+                    vertexIndex += line.vertexCount;
+                }
+
+                m_transform = states.transform;
+                m_transformedVerticesValid = true;
+                m_version = RenderBatch::createGeometryVersion();
+            }
+
+            const std::shared_ptr<sf::Font> font = m_font;
+            states.transform = sf::Transform::Identity;
+            Text::selectTexture(states, *m_layout, *font, m_characterSize);
+
+            RenderBatch* batch = RenderBatch::getActive(target);
+            if (batch)
+                batch->addTriangles(m_transformedVertices.data(), m_transformedVertices.size(), states, m_version);
+            else
+                target.draw(m_transformedVertices.data(), m_transformedVertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
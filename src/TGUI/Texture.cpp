@@ -208,7 +208,12 @@ namespace tgui
     sf::Vector2f Texture::getImageSize() const
     {
         if (m_data)
-            return sf::Vector2f{m_data->texture.getSize()};
+        {
+            if (m_data->atlasTexture)
+                return {static_cast<float>(m_data->atlasRect.width), static_cast<float>(m_data->atlasRect.height)};
+            else
+                return sf::Vector2f{m_data->texture.getSize()};
+        }
         else
             return {0,0};
     }
@@ -218,14 +223,21 @@ namespace tgui
     void Texture::setSmooth(bool smooth)
     {
         if (m_data)
-            m_data->texture.setSmooth(smooth);
+        {
+            // Smoothing would affect all images in the atlas page, so a smooth texture gets its own texture
+            if (smooth && m_data->atlasTexture)
+                TextureManager::removeFromAtlas(*m_data);
+
+            if (!m_data->atlasTexture)
+                m_data->texture.setSmooth(smooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Texture::isSmooth() const
     {
-        if (m_data)
+        if (m_data && !m_data->atlasTexture)
             return m_data->texture.isSmooth();
         else
             return false;
@@ -245,7 +257,7 @@ namespace tgui
         if (!m_data || !m_data->image)
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < getImageSize().x && pixel.y < getImageSize().y);
 
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
@@ -321,7 +333,7 @@ namespace tgui
         m_data = data;
 
         if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            m_middleRect = {0, 0, static_cast<int>(getImageSize().x), static_cast<int>(getImageSize().y)};
         else
             m_middleRect = middleRect;
     }
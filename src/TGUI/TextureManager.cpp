@@ -27,11 +27,18 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <algorithm>
+#include <cassert>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::list<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+    bool TextureManager::m_atlasEnabled = false;
+    unsigned int TextureManager::m_atlasPageSize = 1024;
+    unsigned int TextureManager::m_atlasPadding = 1;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -80,6 +87,10 @@ namespace tgui
         data->image = texture.getImageLoader()(filename);
         if (data->image != nullptr)
         {
+            // Put the image in a shared texture when possible
+            if (m_atlasEnabled && addToAtlas(*data))
+                return data;
+
             // Create a texture from the image
             bool loadFromImageSuccess;
             if (partRect == sf::IntRect{})
@@ -149,6 +160,184 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasPageSize(unsigned int size)
+    {
+        m_atlasPageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasPageSize()
+    {
+        return m_atlasPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasPadding(unsigned int padding)
+    {
+        m_atlasPadding = padding;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasPadding()
+    {
+        return m_atlasPadding;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAtlasPageCount()
+    {
+        return std::count_if(m_atlasPages.begin(), m_atlasPages.end(), [](const AtlasPage& page){ return !page.texture.expired(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeFromAtlas(TextureData& data)
+    {
+        if (!data.atlasTexture)
+            return;
+
+        // The space in the atlas page is not reused, the page is only released when none of its images are used anymore
+        if (data.image)
+        {
+            if (data.rect == sf::IntRect{})
+                data.texture.loadFromImage(*data.image);
+            else
+                data.texture.loadFromImage(*data.image, data.rect);
+        }
+        else
+            data.texture.loadFromImage(data.atlasTexture->copyToImage(), data.atlasRect);
+
+        data.atlasTexture = nullptr;
+        data.atlasRect = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data)
+    {
+        assert(data.image != nullptr);
+
+        const sf::Vector2u imageSize = data.image->getSize();
+        sf::IntRect imageRect = data.rect;
+        if (imageRect == sf::IntRect{})
+            imageRect = {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+
+        // Invalid parts are left for sf::Texture::loadFromImage to handle
+        if ((imageRect.left < 0) || (imageRect.top < 0) || (imageRect.width <= 0) || (imageRect.height <= 0)
+         || (imageRect.left + imageRect.width > static_cast<int>(imageSize.x))
+         || (imageRect.top + imageRect.height > static_cast<int>(imageSize.y)))
+            return false;
+
+        const unsigned int padding = m_atlasPadding;
+        const unsigned int width = static_cast<unsigned int>(imageRect.width) + 2 * padding;
+        const unsigned int height = static_cast<unsigned int>(imageRect.height) + 2 * padding;
+        const unsigned int pageSize = std::min(m_atlasPageSize, sf::Texture::getMaximumSize());
+        if ((width > pageSize) || (height > pageSize))
+            return false;
+
+        // Finds a place in the page where the image fits. Images are placed next to each other in rows, the row with the
+        // least amount of wasted height is used. A new row is started when the image doesn't fit in any of the existing rows.
+        const auto findSpace = [width,height](AtlasPage& page, sf::Vector2u& position)
+            {
+                AtlasShelf* bestShelf = nullptr;
+                for (auto& shelf : page.shelves)
+                {
+                    if ((height <= shelf.height) && (shelf.usedWidth + width <= page.size)
+                     && (!bestShelf || (shelf.height < bestShelf->height)))
+                    {
+                        bestShelf = &shelf;
+                    }
+                }
+
+                if (bestShelf)
+                {
+                    position = {bestShelf->usedWidth, bestShelf->top};
+                    bestShelf->usedWidth += width;
+                    return true;
+                }
+
+                const unsigned int top = page.shelves.empty() ? 0 : page.shelves.back().top + page.shelves.back().height;
+                if (top + height > page.size)
+                    return false;
+
+                page.shelves.push_back({top, height, width});
+                position = {0, top};
+                return true;
+            };
+
+        // Pages of which all images were removed no longer exist
+        m_atlasPages.remove_if([](const AtlasPage& page){ return page.texture.expired(); });
+
+        std::shared_ptr<sf::Texture> pageTexture;
+        sf::Vector2u position;
+        for (auto& page : m_atlasPages)
+        {
+            if (findSpace(page, position))
+            {
+                pageTexture = page.texture.lock();
+                break;
+            }
+        }
+
+        if (!pageTexture)
+        {
+            pageTexture = std::make_shared<sf::Texture>();
+            if (!pageTexture->create(pageSize, pageSize))
+                return false;
+
+            m_atlasPages.push_back({pageTexture, pageSize, {}});
+            if (!findSpace(m_atlasPages.back(), position))
+                return false;
+        }
+
+        // Copy the image and fill the padding with the pixels on its edges, so that scaling the image never samples
+        // the pixels of its neighbours in the atlas
+        sf::Image paddedImage;
+        paddedImage.create(width, height, sf::Color::Transparent);
+        paddedImage.copy(*data.image, padding, padding, imageRect);
+        if (padding > 0)
+        {
+            const unsigned int lastX = padding + static_cast<unsigned int>(imageRect.width) - 1;
+            const unsigned int lastY = padding + static_cast<unsigned int>(imageRect.height) - 1;
+            for (unsigned int y = 0; y < height; ++y)
+            {
+                const unsigned int sourceY = std::min(std::max(y, padding), lastY);
+                for (unsigned int x = 0; x < width; ++x)
+                {
+                    const unsigned int sourceX = std::min(std::max(x, padding), lastX);
+                    if ((sourceX != x) || (sourceY != y))
+                        paddedImage.setPixel(x, y, paddedImage.getPixel(sourceX, sourceY));
+                }
+            }
+        }
+
+        pageTexture->update(paddedImage, position.x, position.y);
+
+        data.atlasTexture = pageTexture;
+        data.atlasRect = {static_cast<int>(position.x + padding), static_cast<int>(position.y + padding), imageRect.width, imageRect.height};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
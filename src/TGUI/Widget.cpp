@@ -25,9 +25,12 @@
 
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/Gui.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -96,6 +99,8 @@ namespace tgui
         m_allowFocus                   {other.m_allowFocus},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_batchedDrawing               {other.m_batchedDrawing},
+        m_allowCulling                 {other.m_allowCulling},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {other.m_showAnimations},
@@ -136,6 +141,8 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_batchedDrawing               {std::move(other.m_batchedDrawing)},
+        m_allowCulling                 {std::move(other.m_allowCulling)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
@@ -186,6 +193,8 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
+            m_batchedDrawing       = other.m_batchedDrawing;
+            m_allowCulling         = other.m_allowCulling;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_showAnimations       = {};
@@ -236,6 +245,8 @@ namespace tgui
             m_allowFocus           = std::move(other.m_allowFocus);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
+            m_batchedDrawing       = std::move(other.m_batchedDrawing);
+            m_allowCulling         = std::move(other.m_allowCulling);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
@@ -305,6 +316,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,6 +377,7 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
+            invalidate();
             onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
@@ -382,6 +396,7 @@ namespace tgui
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
+            invalidate();
             onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
@@ -417,7 +432,11 @@ namespace tgui
 
     void Widget::show()
     {
-        m_visible = true;
+        if (!m_visible)
+        {
+            m_visible = true;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -485,7 +504,12 @@ namespace tgui
 
     void Widget::hide()
     {
-        m_visible = false;
+        if (m_visible)
+        {
+            // The gui is only redrawn for widgets that are visible, so invalidate before hiding it
+            invalidate();
+            m_visible = false;
+        }
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -547,14 +571,22 @@ namespace tgui
 
     void Widget::enable()
     {
-        m_enabled = true;
+        if (!m_enabled)
+        {
+            m_enabled = true;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::disable()
     {
-        m_enabled = false;
+        if (m_enabled)
+        {
+            m_enabled = false;
+            invalidate();
+        }
 
         // Change the mouse button state.
         m_mouseHover = false;
@@ -605,10 +637,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        // The render caches are always cleared, because a hidden parent will need up-to-date contents when it is shown again
+        bool visible = m_visible;
+        Widget* root = this;
+        while (root->m_parent)
+        {
+            root->m_parent->m_renderCacheValid = false;
+            root = root->m_parent;
+            visible = visible && root->m_visible;
+        }
+
+        // When the widget is visible inside a gui then the gui has to be redrawn
+        if (visible && root->m_containerWidget)
+        {
+            const auto guiContainer = dynamic_cast<GuiContainer*>(root);
+            if (guiContainer && guiContainer->m_gui)
+                guiContainer->m_gui->invalidate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
         rendererChanged("font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -624,6 +680,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -677,6 +734,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Widget::getTimeUntilNextUpdate() const
+    {
+        // Animations change the widget every frame
+        if (!m_showAnimations.empty())
+            return sf::Time::Zero;
+
+        return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(sf::Vector2f)
     {
     }
@@ -729,6 +797,7 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
+        invalidate();
         onFocus.emit(this);
 
         // Make sure the parent is also focused
@@ -740,6 +809,7 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
+        invalidate();
         onUnfocus.emit(this);
     }
 
@@ -755,7 +825,11 @@ namespace tgui
 
     void Widget::mouseNoLongerDown()
     {
-        m_mouseDown = false;
+        if (m_mouseDown)
+        {
+            m_mouseDown = false;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -840,6 +914,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -848,6 +923,7 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -856,6 +932,7 @@ namespace tgui
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -865,14 +942,24 @@ namespace tgui
                                     sf::Vector2f size,
                                     sf::Color color) const
     {
-        sf::RectangleShape shape{size};
+        const sf::Color fillColor = (m_opacityCached < 1) ? Color::calcColorOpacity(color, m_opacityCached) : color;
 
-        if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
+        // The active batch writes the rectangle directly into its vertex arena
+        priv::RenderBatch* batch = priv::RenderBatch::getActive(target);
+        if (batch)
+        {
+            batch->addRectangle(size, fillColor, states);
+            return;
+        }
+
+        const sf::Vertex vertices[] = {
+            {{0, 0}, fillColor},
+            {{0, size.y}, fillColor},
+            {{size.x, 0}, fillColor},
+            {{size.x, size.y}, fillColor}
+        };
 
-        target.draw(shape, states);
+        target.draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -885,13 +972,24 @@ namespace tgui
     {
         const sf::Color color = Color::calcColorOpacity(borderColor, m_opacityCached);
 
+        priv::RenderBatch* batch = priv::RenderBatch::getActive(target);
+        if (batch)
+        {
+            batch->addBorders(borders, size, color, states);
+            return;
+        }
+
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, 0}, color},
+                {{size.x, size.y}, color}
+            };
+
+            target.draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -905,7 +1003,7 @@ namespace tgui
             // |              | //
             // 2--------------4 //
             //////////////////////
-            const std::vector<sf::Vertex> vertices = {
+            const sf::Vertex vertices[] = {
                 {{0, 0}, color},
                 {{borders.getLeft(), 0}, color},
                 {{0, size.y}, color},
@@ -918,7 +1016,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            target.draw(vertices, 10, sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
@@ -34,6 +34,7 @@ namespace tgui
     Button::Button()
     {
         m_type = "Button";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<ButtonRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -139,7 +140,10 @@ namespace tgui
             m_text.setCharacterSize(m_textSize);
 
         if ((getInnerSize().x < 0) || (getInnerSize().y < 0))
+        {
+            invalidate();
             return;
+        }
 
         // Draw the text normally unless the height is more than double of the width
         if (getInnerSize().y <= getInnerSize().x * 2)
@@ -177,6 +181,8 @@ namespace tgui
                     m_text.setCharacterSize(static_cast<unsigned int>(textSize * getInnerSize().y * 0.85f / m_text.getSize().y));
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
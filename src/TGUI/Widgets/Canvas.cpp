@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/RenderBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +35,7 @@ namespace tgui
     Canvas::Canvas(const Layout2d& size)
     {
         m_type = "Canvas";
+        m_batchedDrawing = true;
 
         setSize(size);
     }
@@ -142,6 +144,7 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +162,7 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
+        priv::RenderBatch::flushActive(target);
         target.draw(m_sprite, states);
     }
 
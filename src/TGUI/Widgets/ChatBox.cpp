@@ -25,6 +25,10 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/TextRelayoutPass.hpp>
+#include <algorithm>
+#include <cmath>
 
 /// TODO: Same font for all lines?
 
@@ -37,6 +41,7 @@ namespace tgui
     ChatBox::ChatBox()
     {
         m_type = "ChatBox";
+        m_batchedDrawing = true;
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<ChatBoxRenderer>();
@@ -141,13 +146,13 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font)
     {
-        // Remove the oldest line if you exceed the maximum
-        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
+        // Remove the oldest line if you exceed the maximum, its slot in the buffer is reused for the new line
+        if ((m_maxLines > 0) && (m_maxLines == m_lines.getSize()))
         {
             if (m_newLinesBelowOthers)
-                removeLine(0);
+                eraseLine(0);
             else
-                removeLine(m_maxLines-1);
+                eraseLine(m_maxLines-1);
         }
 
         Line line;
@@ -159,22 +164,39 @@ namespace tgui
         line.text.setFont(font != nullptr ? font : m_fontCached);
 
         recalculateLineText(line);
+        m_fullTextHeight += line.height;
 
+        // The buffer grows until it can contain the maximum amount of lines, from then on its capacity remains fixed
+        if ((m_maxLines > 0) && (m_lines.getSize() == m_lines.getCapacity()))
+            m_lines.setCapacity(std::min(std::max<std::size_t>(2 * m_lines.getCapacity(), 8), m_maxLines));
+
+        // The line is placed directly below the last line or above the first one, the other lines keep their position
         if (m_newLinesBelowOthers)
-            m_lines.push_back(std::move(line));
+        {
+            if (m_lines.getSize() > 0)
+                line.top = m_lines[m_lines.getSize() - 1].top + m_lines[m_lines.getSize() - 1].height;
+
+            m_lines.pushBack(std::move(line));
+        }
         else
-            m_lines.push_front(std::move(line));
+        {
+            if (m_lines.getSize() > 0)
+                line.top = m_lines[0].top - line.height;
 
-        recalculateFullTextHeight();
+            m_lines.pushFront(std::move(line));
+        }
+
+        updateScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ChatBox::getLine(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lines.getSize())
         {
-            return m_lines[lineIndex].string;
+            return m_lines[lineIndex].string.toString();
         }
         else // Index too high
             return "";
@@ -184,7 +206,7 @@ namespace tgui
 
     sf::Color ChatBox::getLineColor(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lines.getSize())
         {
             return m_lines[lineIndex].text.getColor();
         }
@@ -196,7 +218,7 @@ namespace tgui
 
     unsigned int ChatBox::getLineTextSize(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lines.getSize())
         {
             return m_lines[lineIndex].text.getCharacterSize();
         }
@@ -208,7 +230,7 @@ namespace tgui
 
     std::shared_ptr<sf::Font> ChatBox::getLineFont(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lines.getSize())
         {
             return m_lines[lineIndex].text.getFont();
         }
@@ -220,11 +242,11 @@ namespace tgui
 
     bool ChatBox::removeLine(std::size_t lineIndex)
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lines.getSize())
         {
-            m_lines.erase(m_lines.begin() + lineIndex);
-
-            recalculateFullTextHeight();
+            eraseLine(lineIndex);
+            updateScrollbarMaximum();
+            invalidate();
             return true;
         }
         else // Index too high
@@ -236,15 +258,17 @@ namespace tgui
     void ChatBox::removeAllLines()
     {
         m_lines.clear();
+        m_fullTextHeight = 0;
 
-        recalculateFullTextHeight();
+        updateScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t ChatBox::getLineAmount()
     {
-        return m_lines.size();
+        return m_lines.getSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,15 +278,29 @@ namespace tgui
         m_maxLines = maxLines;
 
         // Remove the oldest lines if there are too many lines
-        if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
+        if ((m_maxLines > 0) && (m_maxLines < m_lines.getSize()))
         {
-            if (m_newLinesBelowOthers)
-                m_lines.erase(m_lines.begin(), m_lines.begin() + m_lines.size() - m_maxLines);
-            else
-                m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
+            while (m_lines.getSize() > m_maxLines)
+            {
+                if (m_newLinesBelowOthers)
+                {
+                    m_fullTextHeight -= m_lines[0].height;
+                    m_lines.popFront();
+                }
+                else
+                {
+                    m_fullTextHeight -= m_lines[m_lines.getSize() - 1].height;
+                    m_lines.popBack();
+                }
+            }
 
-            recalculateFullTextHeight();
+            updateScrollbarMaximum();
+            invalidate();
         }
+
+        // The buffer never grows past the line limit
+        if ((m_maxLines > 0) && (m_lines.getCapacity() > m_maxLines))
+            m_lines.setCapacity(m_maxLines);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +322,14 @@ namespace tgui
             m_textSize = 8;
 
         m_scroll.setScrollAmount(size);
+
+        // The rows of a data source always use the default text size
+        if (m_rowCache.getDataSource())
+        {
+            m_dataSourceTexts.clear();
+            updateScrollbarMaximum();
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,6 +344,15 @@ namespace tgui
     void ChatBox::setTextColor(Color color)
     {
         m_textColor = color;
+
+        // Existing lines keep their color, only the rows of a data source use the new one
+        if (!m_dataSourceTexts.empty())
+        {
+            for (auto& text : m_dataSourceTexts)
+                text.setColor(m_textColor);
+
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -312,7 +367,10 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         if (m_linesStartFromTop != startFromTop)
+        {
             m_linesStartFromTop = startFromTop;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -338,6 +396,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::setDataSource(DataSource::Ptr dataSource)
+    {
+        m_rowCache.setDataSource(std::move(dataSource));
+        m_dataSourceTexts.clear();
+        m_firstDataSourceRow = 0;
+
+        updateScrollbarMaximum();
+
+        if (m_rowCache.getDataSource())
+            updateDataSourceRows();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataSource::Ptr ChatBox::getDataSource() const
+    {
+        return m_rowCache.getDataSource();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::setPrefetchDistance(std::size_t rowCount)
+    {
+        m_prefetchDistance = rowCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ChatBox::getPrefetchDistance() const
+    {
+        return m_prefetchDistance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::setMaximumCachedRows(std::size_t rowCount)
+    {
+        m_rowCache.setMaximumRows(rowCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ChatBox::getMaximumCachedRows() const
+    {
+        return m_rowCache.getMaximumRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ChatBox::mouseOnWidget(sf::Vector2f pos) const
     {
         return sf::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
@@ -352,7 +461,12 @@ namespace tgui
 
         // Pass the event to the scrollbar
         if (m_scroll.mouseOnWidget(pos - getPosition()))
+        {
+            const auto oldScrollState = m_scroll.getInteractionState();
             m_scroll.leftMousePressed(pos - getPosition());
+            if (m_scroll.getInteractionState() != oldScrollState)
+                invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,7 +474,12 @@ namespace tgui
     void ChatBox::leftMouseReleased(sf::Vector2f pos)
     {
         if (m_scroll.isMouseDown())
+        {
+            const auto oldScrollState = m_scroll.getInteractionState();
             m_scroll.leftMouseReleased(pos - getPosition());
+            if (m_scroll.getInteractionState() != oldScrollState)
+                invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -370,11 +489,16 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        const auto oldScrollState = m_scroll.getInteractionState();
+
         // Pass the event to the scrollbar when the mouse is on top of it or when we are dragging its thumb
         if (((m_scroll.isMouseDown()) && (m_scroll.isMouseDownOnThumb())) || m_scroll.mouseOnWidget(pos - getPosition()))
             m_scroll.mouseMoved(pos - getPosition());
         else
             m_scroll.mouseNoLongerOnWidget();
+
+        if (m_scroll.getInteractionState() != oldScrollState)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,7 +506,11 @@ namespace tgui
     void ChatBox::mouseNoLongerOnWidget()
     {
         Widget::mouseNoLongerOnWidget();
+
+        const auto oldScrollState = m_scroll.getInteractionState();
         m_scroll.mouseNoLongerOnWidget();
+        if (m_scroll.getInteractionState() != oldScrollState)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -390,7 +518,11 @@ namespace tgui
     void ChatBox::mouseNoLongerDown()
     {
         Widget::mouseNoLongerDown();
+
+        const auto oldScrollState = m_scroll.getInteractionState();
         m_scroll.mouseNoLongerDown();
+        if (m_scroll.getInteractionState() != oldScrollState)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,7 +530,12 @@ namespace tgui
     void ChatBox::mouseWheelScrolled(float delta, sf::Vector2f pos)
     {
         if (m_scroll.getLowValue() < m_scroll.getMaximum())
+        {
+            const auto oldScrollState = m_scroll.getInteractionState();
             m_scroll.mouseWheelScrolled(delta, pos - getPosition());
+            if (m_scroll.getInteractionState() != oldScrollState)
+                invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,21 +543,60 @@ namespace tgui
     void ChatBox::recalculateLineText(Line& line)
     {
         line.text.setString("");
+        line.height = 0;
 
         // Find the maximum width of one line
         const float maxWidth = getInnerSize().x - m_scroll.getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
         if (maxWidth < 0)
             return;
 
-        line.text.setString(Text::wordWrap(maxWidth, line.string, line.text.getFont(), line.text.getCharacterSize(), false));
+        line.text.setString(Text::wordWrap(maxWidth, line.string.toString(), line.text.getFont(), line.text.getCharacterSize(), false));
+        line.height = line.text.getSize().y;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateAllLines()
     {
-        for (auto& line : m_lines)
-            recalculateLineText(line);
+        const float maxWidth = getInnerSize().x - m_scroll.getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+        if (maxWidth < 0)
+        {
+            for (std::size_t i = 0; i < m_lines.getSize(); ++i)
+            {
+                m_lines[i].text.setString("");
+                m_lines[i].height = 0;
+            }
+        }
+        else
+        {
+            std::size_t characterCount = 0;
+            for (std::size_t i = 0; i < m_lines.getSize(); ++i)
+                characterCount += m_lines[i].string.getSize();
+
+            // Long chat histories are wrapped on multiple threads, the texts are only changed afterwards on this thread
+            std::vector<sf::String> wrappedStrings(m_lines.getSize());
+            const auto wrap = [this,maxWidth,&wrappedStrings](std::size_t i){
+                const Line& line = m_lines[i];
+                wrappedStrings[i] = Text::wordWrap(maxWidth, line.string.toString(), line.text.getFont(), line.text.getCharacterSize(), false);
+            };
+
+            const auto preload = [this](std::size_t i){
+                const Line& line = m_lines[i];
+                if (line.text.getFont() == nullptr)
+                    return;
+
+                const sf::String string = line.string.toString();
+                priv::GlyphMetrics::get(line.text.getFont().getFont(), line.text.getCharacterSize(), false).preload(string.getData(), string.getSize());
+            };
+
+            TextRelayoutPass::parallelFor(m_lines.getSize(), characterCount, wrap, preload);
+
+            for (std::size_t i = 0; i < m_lines.getSize(); ++i)
+            {
+                m_lines[i].text.setString(wrappedStrings[i]);
+                m_lines[i].height = m_lines[i].text.getSize().y;
+            }
+        }
 
         recalculateFullTextHeight();
     }
@@ -430,12 +606,77 @@ namespace tgui
     void ChatBox::recalculateFullTextHeight()
     {
         m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        for (std::size_t i = 0; i < m_lines.getSize(); ++i)
+        {
+            m_lines[i].top = m_fullTextHeight;
+            m_fullTextHeight += m_lines[i].height;
+        }
 
-        // Update the maximum of the scrollbar
+        updateScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ChatBox::findLineAtOffset(double offset) const
+    {
+        // Binary search for the last line that starts at or above the offset, using the prefix sums stored in the lines
+        const double firstTop = m_lines[0].top;
+        std::size_t low = 0;
+        std::size_t high = m_lines.getSize();
+        while (high - low > 1)
+        {
+            const std::size_t middle = low + (high - low) / 2;
+            if (m_lines[middle].top - firstTop <= offset)
+                low = middle;
+            else
+                high = middle;
+        }
+
+        return low;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double ChatBox::getShownTextHeight() const
+    {
+        if (m_rowCache.getDataSource())
+            return m_rowCache.getRowCount() * static_cast<double>(getDataSourceRowHeight());
+        else
+            return m_fullTextHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::eraseLine(std::size_t lineIndex)
+    {
+        // The lines on the same side as the ones that the buffer moves to fill the gap are shifted to close the gap.
+        // Removing the first or last line doesn't require changing the other lines.
+        const float height = m_lines[lineIndex].height;
+        if (lineIndex < m_lines.getSize() / 2)
+        {
+            for (std::size_t i = 0; i < lineIndex; ++i)
+                m_lines[i].top += height;
+        }
+        else
+        {
+            for (std::size_t i = lineIndex + 1; i < m_lines.getSize(); ++i)
+                m_lines[i].top -= height;
+        }
+
+        m_fullTextHeight -= height;
+        m_lines.erase(lineIndex);
+
+        // Don't let rounding errors accumulate
+        if (m_lines.getSize() == 0)
+            m_fullTextHeight = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateScrollbarMaximum()
+    {
         const unsigned int oldMaximum = m_scroll.getMaximum();
-        m_scroll.setMaximum(static_cast<unsigned int>(m_fullTextHeight));
+        m_scroll.setMaximum(static_cast<unsigned int>(getShownTextHeight()));
 
         // Scroll down to the last item when there is a scrollbar and it is at the bottom
         if (m_newLinesBelowOthers)
@@ -450,6 +691,65 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float ChatBox::getDataSourceRowHeight() const
+    {
+        if (m_fontCached == nullptr)
+            return 0;
+
+        return m_fontCached.getLineSpacing(m_textSize) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateDataSourceRows()
+    {
+        if (m_rowCache.updateRowCount())
+        {
+            invalidate();
+            updateScrollbarMaximum();
+        }
+
+        // Find out which rows are visible
+        const std::size_t rowCount = m_rowCache.getRowCount();
+        const double rowHeight = getDataSourceRowHeight();
+        std::size_t firstVisibleRow = 0;
+        std::size_t lastVisibleRow = rowCount;
+        if ((rowHeight > 0) && (m_scroll.getLowValue() < m_scroll.getMaximum()))
+        {
+            firstVisibleRow = std::min(static_cast<std::size_t>(m_scroll.getValue() / rowHeight), rowCount);
+            lastVisibleRow = std::min(static_cast<std::size_t>(std::ceil((m_scroll.getValue() + m_scroll.getLowValue()) / rowHeight)), rowCount);
+        }
+
+        // Load the visible rows, together with the rows that are close enough to be scrolled into view soon
+        const std::size_t firstRow = firstVisibleRow - std::min(firstVisibleRow, m_prefetchDistance);
+        const std::size_t lastRow = std::min(lastVisibleRow + m_prefetchDistance, rowCount);
+        if (m_rowCache.requestRows(firstRow, lastRow))
+            onRowsNeeded.emit(this, static_cast<int>(firstRow), static_cast<int>(lastRow - 1));
+
+        // Only the visible rows get a text, they are recreated when other rows became visible or when new rows arrived
+        const bool rowsAdded = m_rowCache.applyFetchedRows();
+        if (!rowsAdded && (m_firstDataSourceRow == firstVisibleRow) && (m_dataSourceTexts.size() == lastVisibleRow - firstVisibleRow))
+            return;
+
+        m_firstDataSourceRow = firstVisibleRow;
+        m_dataSourceTexts.resize(lastVisibleRow - firstVisibleRow);
+        for (std::size_t i = 0; i < m_dataSourceTexts.size(); ++i)
+        {
+            Text& text = m_dataSourceTexts[i];
+            text.setColor(m_textColor);
+            text.setOpacity(m_opacityCached);
+            text.setCharacterSize(m_textSize);
+            text.setFont(m_fontCached);
+
+            const sf::String* row = m_rowCache.getRow(firstVisibleRow + i);
+            text.setString(row ? *row : "");
+        }
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::updateRendering()
     {
         m_scroll.setSize({m_scroll.getSize().x, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
@@ -495,8 +795,11 @@ namespace tgui
             m_spriteBackground.setOpacity(m_opacityCached);
             m_scroll.setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
+            for (std::size_t i = 0; i < m_lines.getSize(); ++i)
+                m_lines[i].text.setOpacity(m_opacityCached);
+
+            for (auto& text : m_dataSourceTexts)
+                text.setOpacity(m_opacityCached);
         }
         else if (property == "font")
         {
@@ -506,11 +809,11 @@ namespace tgui
             {
                 // Look for lines that did not have a font yet and give them this font
                 bool lineChanged = false;
-                for (auto& line : m_lines)
+                for (std::size_t i = 0; i < m_lines.getSize(); ++i)
                 {
-                    if (line.text.getFont() == nullptr)
+                    if (m_lines[i].text.getFont() == nullptr)
                     {
-                        line.text.setFont(m_fontCached);
+                        m_lines[i].text.setFont(m_fontCached);
                         lineChanged = true;
                     }
                 }
@@ -518,6 +821,13 @@ namespace tgui
                 if (lineChanged)
                     recalculateAllLines();
             }
+
+            // The rows of a data source always use the font of the chat box
+            if (m_rowCache.getDataSource())
+            {
+                m_dataSourceTexts.clear();
+                updateScrollbarMaximum();
+            }
         }
         else
             Widget::rendererChanged(property);
@@ -533,6 +843,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::pair<std::size_t, std::size_t> ChatBox::getVisibleLines() const
+    {
+        const unsigned int scrollValue = m_scroll.getValue();
+        return {findLineAtOffset(scrollValue),
+                findLineAtOffset(scrollValue + getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom())};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        if (m_rowCache.getDataSource())
+            updateDataSourceRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time ChatBox::getTimeUntilNextUpdate() const
+    {
+        // Rows that are being fetched have to be shown soon after they arrive
+        return std::min(Widget::getTimeUntilNextUpdate(), m_rowCache.getTimeUntilNextPoll());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& ChatBox::getSignal(std::string signalName)
+    {
+        if (signalName == toLower(onRowsNeeded.getName()))
+            return onRowsNeeded;
+        else
+            return Widget::getSignal(std::move(signalName));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -560,16 +907,34 @@ namespace tgui
         // Set the clipping for all draw calls that happen until this clipping object goes out of scope
         const Clipping clipping{target, states, {}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - m_scroll.getSize().x, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
 
-        states.transform.translate({0, -static_cast<float>(m_scroll.getValue())});
-
         // Put the lines at the bottom of the chat box if needed
-        if (!m_linesStartFromTop && (m_fullTextHeight < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
-            states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight);
+        const float fullTextHeight = static_cast<float>(getShownTextHeight());
+        if (!m_linesStartFromTop && (fullTextHeight < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
+            states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - fullTextHeight);
 
-        for (const auto& line : m_lines)
+        if (m_rowCache.getDataSource())
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            // The rows are positioned relative to the first visible one, as floats aren't precise enough for large data sets
+            const double rowHeight = getDataSourceRowHeight();
+            states.transform.translate({0, static_cast<float>(m_firstDataSourceRow * rowHeight - m_scroll.getValue())});
+            for (const auto& text : m_dataSourceTexts)
+            {
+                text.draw(target, states);
+                states.transform.translate(0, static_cast<float>(rowHeight));
+            }
+        }
+        else if (m_lines.getSize() > 0)
+        {
+            // Only the lines between the top and bottom of the visible area are drawn
+            const auto visibleLines = getVisibleLines();
+
+            // The lines are positioned relative to the first visible one, as floats aren't precise enough for long histories
+            states.transform.translate({0, static_cast<float>(m_lines[visibleLines.first].top - m_lines[0].top - m_scroll.getValue())});
+            for (std::size_t i = visibleLines.first; i <= visibleLines.second; ++i)
+            {
+                m_lines[i].text.draw(target, states);
+                states.transform.translate(0, m_lines[i].height);
+            }
         }
     }
 
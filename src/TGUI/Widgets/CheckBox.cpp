@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -117,6 +118,7 @@ namespace tgui
                 m_text.setStyle(m_textStyleCheckedCached);
             else
                 m_text.setStyle(m_textStyleCached);
+            invalidate();
 
             onCheck.emit(this, true);
         }
@@ -266,6 +268,7 @@ namespace tgui
                 // Set the clipping for all draw calls that happen until this clipping object goes out of scope
                 const Clipping clipping{target, states, {}, size};
 
+                priv::RenderBatch::flushActive(target);
                 target.draw(left, states);
                 target.draw(right, states);
             }
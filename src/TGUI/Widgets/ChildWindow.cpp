@@ -53,6 +53,7 @@ namespace tgui
     ChildWindow::ChildWindow(const sf::String& title, unsigned int titleButtons)
     {
         m_type = "ChildWindow";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<ChildWindowRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -241,6 +242,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -258,6 +260,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,6 +310,7 @@ namespace tgui
             m_minimizeButton = nullptr;
 
         updateTitleBarHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,7 +417,9 @@ namespace tgui
             {
                 if (button && button->mouseOnWidget(pos))
                 {
+                    // The title buttons aren't part of the widget tree, so they can't redraw the window themselves
                     button->leftMousePressed(pos);
+                    invalidate();
                     return;
                 }
             }
@@ -541,10 +547,15 @@ namespace tgui
             {
                 if (button)
                 {
+                    const bool buttonHovered = button->isMouseHovered();
+
                     if (button->mouseOnWidget(pos))
                         button->mouseMoved(pos);
                     else
                         button->mouseNoLongerOnWidget();
+
+                    if (button->isMouseHovered() != buttonHovered)
+                        invalidate();
                 }
             }
 
@@ -558,8 +569,11 @@ namespace tgui
             // When the mouse is not on the title bar, the mouse can't be on the buttons inside it
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
-                if (button)
+                if (button && button->isMouseHovered())
+                {
                     button->mouseNoLongerOnWidget();
+                    invalidate();
+                }
             }
 
             // Check if the mouse is on top of the borders
@@ -815,7 +829,7 @@ namespace tgui
 
         // Draw the widgets in the child window
         const Clipping clipping{target, states, {}, {getSize()}};
-        drawWidgetContainer(&target, states);
+        drawCachedWidgetContainer(&target, states, getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
@@ -37,6 +38,7 @@ namespace tgui
     ComboBox::ComboBox()
     {
         m_type = "ComboBox";
+        m_batchedDrawing = true;
 
         m_draggableWidget = true;
 
@@ -265,7 +267,7 @@ namespace tgui
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
         const bool ret = m_listBox->setSelectedItem(itemName);
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
         return ret;
     }
 
@@ -274,7 +276,7 @@ namespace tgui
     bool ComboBox::setSelectedItemById(const sf::String& id)
     {
         const bool ret = m_listBox->setSelectedItemById(id);
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
         return ret;
     }
 
@@ -283,7 +285,7 @@ namespace tgui
     bool ComboBox::setSelectedItemByIndex(std::size_t index)
     {
         const bool ret = m_listBox->setSelectedItemByIndex(index);
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
         return ret;
     }
 
@@ -291,8 +293,8 @@ namespace tgui
 
     void ComboBox::deselectItem()
     {
-        m_text.setString("");
         m_listBox->deselectItem();
+        updateSelectedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,7 +305,7 @@ namespace tgui
 
         const bool ret = m_listBox->removeItem(itemName);
 
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -316,14 +318,15 @@ namespace tgui
 
     bool ComboBox::removeItemById(const sf::String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        const bool ret = m_listBox->removeItemById(id);
+
+        updateSelectedText();
+
+        // Shrink the list size
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+            updateListBoxHeight();
 
-        return false;
+        return ret;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -332,7 +335,7 @@ namespace tgui
     {
         const bool ret = m_listBox->removeItemByIndex(index);
 
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -345,8 +348,8 @@ namespace tgui
 
     void ComboBox::removeAllItems()
     {
-        m_text.setString("");
         m_listBox->removeAllItems();
+        updateSelectedText();
 
         updateListBoxHeight();
     }
@@ -384,7 +387,7 @@ namespace tgui
     bool ComboBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
         return ret;
     }
 
@@ -393,7 +396,7 @@ namespace tgui
     bool ComboBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
         return ret;
     }
 
@@ -402,7 +405,7 @@ namespace tgui
     bool ComboBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
-        m_text.setString(m_listBox->getSelectedItem());
+        updateSelectedText();
         return ret;
     }
 
@@ -415,7 +418,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::vector<sf::String>& ComboBox::getItemIds()
+    std::vector<sf::String> ComboBox::getItemIds()
     {
         return m_listBox->getItemIds();
     }
@@ -440,6 +443,7 @@ namespace tgui
     {
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -512,7 +516,7 @@ namespace tgui
                 if (static_cast<std::size_t>(m_listBox->getSelectedItemIndex() + 1) < m_listBox->getItemCount())
                 {
                     m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() + 1));
-                    m_text.setString(m_listBox->getSelectedItem());
+                    updateSelectedText();
                 }
             }
             else // You are scrolling up
@@ -521,7 +525,7 @@ namespace tgui
                 if (m_listBox->getSelectedItemIndex() > 0)
                 {
                     m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() - 1));
-                    m_text.setString(m_listBox->getSelectedItem());
+                    updateSelectedText();
                 }
             }
         }
@@ -692,12 +696,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::updateSelectedText()
+    {
+        const sf::String selectedItem = m_listBox->getSelectedItem();
+        if (m_text.getString() != selectedItem)
+        {
+            m_text.setString(selectedItem);
+            invalidate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::initListBox()
     {
         m_listBox->hide();
 
         m_listBox->connect("ItemSelected", [this](){
-                                                m_text.setString(m_listBox->getSelectedItem());
+                                                updateSelectedText();
                                                 onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
                                             });
 
@@ -762,6 +778,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
+            priv::RenderBatch::flushActive(target);
             target.draw(arrow, states);
         }
 
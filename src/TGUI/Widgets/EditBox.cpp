@@ -27,6 +27,7 @@
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/GlyphMetrics.hpp>
 
 /// TODO: Where m_selStart and m_selEnd are compared, use std::min and std::max and merge the if and else bodies
 
@@ -46,6 +47,7 @@ namespace tgui
     EditBox::EditBox()
     {
         m_type = "EditBox";
+        m_batchedDrawing = true;
 
         m_draggableWidget = true;
         m_allowFocus = true;
@@ -250,6 +252,7 @@ namespace tgui
     void EditBox::setDefaultText(const sf::String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -390,6 +393,8 @@ namespace tgui
             // If the caret was behind the limit, then set it at the end
             if (m_selEnd > m_textFull.getString().getSize())
                 setCaretPosition(m_selEnd);
+            else
+                invalidate();
         }
     }
 
@@ -499,7 +504,12 @@ namespace tgui
         onMousePress.emit(this, pos);
 
         // The caret should be visible
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidate();
+        }
+
         m_animationTimeElapsed = {};
     }
 
@@ -839,7 +849,12 @@ namespace tgui
         }
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidate();
+        }
+
         m_animationTimeElapsed = {};
     }
 
@@ -899,7 +914,12 @@ namespace tgui
         setCaretPosition(m_selEnd + 1);
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidate();
+        }
+
         m_animationTimeElapsed = {};
 
         onTextChange.emit(this, m_text);
@@ -1129,6 +1149,7 @@ namespace tgui
         sf::Uint32 prevChar = 0;
         const unsigned int textSize = getTextSize();
         const bool bold = (m_textFull.getStyle() & sf::Text::Bold) != 0;
+        priv::GlyphMetrics& metrics = priv::GlyphMetrics::get(m_fontCached.getFont(), textSize, bold);
 
         std::size_t index;
         for (index = 0; index < m_text.getSize(); ++index)
@@ -1142,12 +1163,10 @@ namespace tgui
                 prevChar = 0;
                 continue;
             }
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                charWidth = metrics.getAdvance(curChar); // A tab is as wide as 4 spaces
 
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, textSize));
+            const float kerning = metrics.getKerning(prevChar, curChar);
             if (width + charWidth < posX)
                 width += charWidth + kerning;
             else
@@ -1293,6 +1312,8 @@ namespace tgui
             m_textAfterSelection.setString("");
         }
 
+        invalidate();
+
         if (!m_fontCached)
             return;
 
@@ -1328,6 +1349,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1336,6 +1359,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time EditBox::getTimeUntilNextUpdate() const
+    {
+        // The caret only blinks while the widget is focused
+        if (!m_focused)
+            return Widget::getTimeUntilNextUpdate();
+
+        const sf::Time timeUntilCaretBlink = std::max(sf::Time::Zero, sf::milliseconds(500) - m_animationTimeElapsed);
+        return std::min(Widget::getTimeUntilNextUpdate(), timeUntilCaretBlink);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -35,6 +35,7 @@ namespace tgui
     Group::Group(const Layout2d& size)
     {
         m_type = "Group";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<GroupRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -158,7 +159,7 @@ namespace tgui
         const Clipping clipping{target, states, {}, innerSize};
 
         // Draw the child widgets
-        drawWidgetContainer(&target, states);
+        drawCachedWidgetContainer(&target, states, innerSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -43,6 +44,7 @@ namespace tgui
     Knob::Knob()
     {
         m_type = "Knob";
+        m_batchedDrawing = true;
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<KnobRenderer>();
@@ -125,6 +127,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +150,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +179,7 @@ namespace tgui
 
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
+            invalidate();
         }
     }
 
@@ -207,6 +212,7 @@ namespace tgui
 
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
+            invalidate();
         }
     }
 
@@ -234,6 +240,7 @@ namespace tgui
 
             // The knob might have to point in a different direction
             recalculateRotation();
+            invalidate();
 
             onValueChange.emit(this, m_value);
         }
@@ -254,6 +261,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,6 +556,7 @@ namespace tgui
             bordersShape.setFillColor(sf::Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
+            priv::RenderBatch::flushActive(target);
             target.draw(bordersShape, states);
         }
 
@@ -558,6 +567,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+            priv::RenderBatch::flushActive(target);
             target.draw(background, states);
         }
 
@@ -580,6 +590,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
+            priv::RenderBatch::flushActive(target);
             target.draw(thumb, states);
         }
     }
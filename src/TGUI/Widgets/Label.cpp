@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/TextRelayoutPass.hpp>
 
 #include <cmath>
 
@@ -37,6 +38,7 @@ namespace tgui
     Label::Label()
     {
         m_type = "Label";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<LabelRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -289,8 +291,7 @@ namespace tgui
         else if (property == "textcolor")
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
-                line.setColor(m_textColorCached);
+            m_textVertices.setColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
         }
         else if (property == "bordercolor")
         {
@@ -308,9 +309,7 @@ namespace tgui
         else if (property == "opacity")
         {
             Widget::rendererChanged(property);
-
-            for (auto& line : m_lines)
-                line.setOpacity(m_opacityCached);
+            m_textVertices.setColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
         }
         else
             Widget::rendererChanged(property);
@@ -349,34 +348,34 @@ namespace tgui
                 return;
         }
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
-
-        // Split the string in multiple lines
-        m_lines.clear();
-        float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
+        // Fit the text in the available space. Only the paragraphs that are affected by the change are wrapped again.
+        m_wordWrapper.setFont(m_fontCached, m_textSize, (m_textStyleCached & sf::Text::Bold) != 0);
+        m_wordWrapper.setText(m_string);
+        m_wordWrapper.setMaximumWidth(maxWidth);
 
-            m_lines.emplace_back();
-            m_lines.back().setCharacterSize(getTextSize());
-            m_lines.back().setFont(m_fontCached);
-            m_lines.back().setStyle(m_textStyleCached);
-            m_lines.back().setColor(m_textColorCached);
-            m_lines.back().setOpacity(m_opacityCached);
-
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.back().setString(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.back().setString(string.substring(searchPosStart));
+        // During a relayout pass the text is wrapped on a worker thread and the lines are only created when the pass ends
+        TextRelayoutPass::requestWrap(m_wordWrapper, [this,maxWidth](){ updateLines(maxWidth); });
+    }
 
-            if (m_lines.back().getSize().x > width)
-                width = m_lines.back().getSize().x;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            searchPosStart = newLinePos + 1;
+    void Label::updateLines(float maxWidth)
+    {
+        // Create a text for every line, they are only used to measure and place the lines before their glyphs are stored
+        std::vector<Text> lines;
+        float width = 0;
+        for (const auto& line : m_wordWrapper.getLines())
+        {
+            lines.emplace_back();
+            lines.back().setCharacterSize(getTextSize());
+            lines.back().setFont(m_fontCached);
+            lines.back().setStyle(m_textStyleCached);
+            lines.back().setColor(m_textColorCached);
+            lines.back().setOpacity(m_opacityCached);
+            lines.back().setString(m_string.substring(line.begin, line.end - line.begin));
+
+            if (lines.back().getSize().x > width)
+                width = lines.back().getSize().x;
         }
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
@@ -388,12 +387,16 @@ namespace tgui
         if (m_autoSize)
         {
             Widget::setSize({std::max(width, maxWidth) + outline.getLeft() + outline.getRight(),
-                            (std::max<std::size_t>(m_lines.size(), 1) * m_fontCached.getLineSpacing(m_textSize)) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize, m_textStyleCached) + outline.getTop() + outline.getBottom()});
+                            (std::max<std::size_t>(lines.size(), 1) * m_fontCached.getLineSpacing(m_textSize)) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize, m_textStyleCached) + outline.getTop() + outline.getBottom()});
 
             m_bordersCached.updateParentSize(getSize());
             m_paddingCached.updateParentSize(getSize());
         }
 
+        // The setters only rearrange the text, the label changes once the new lines exist
+        invalidate();
+        m_textVertices.clear();
+
         // Update the line positions
         {
             if ((getSize().x <= outline.getLeft() + outline.getRight()) || (getSize().y <= outline.getTop() + outline.getBottom()))
@@ -404,7 +407,7 @@ namespace tgui
             if (m_verticalAlignment != VerticalAlignment::Top)
             {
                 const float totalHeight = getSize().y - outline.getTop() - outline.getBottom();
-                const float totalTextHeight = m_lines.size() * m_fontCached.getLineSpacing(m_textSize);
+                const float totalTextHeight = lines.size() * m_fontCached.getLineSpacing(m_textSize);
 
                 if (m_verticalAlignment == VerticalAlignment::Center)
                     pos.y += (totalHeight - totalTextHeight) / 2.f;
@@ -415,7 +418,7 @@ namespace tgui
             if (m_horizontalAlignment == HorizontalAlignment::Left)
             {
                 const float lineSpacing = m_fontCached.getLineSpacing(m_textSize);
-                for (auto& line : m_lines)
+                for (auto& line : lines)
                 {
                     line.setPosition(pos.x, pos.y);
                     pos.y += lineSpacing;
@@ -425,7 +428,7 @@ namespace tgui
             {
                 const float totalWidth = getSize().x - outline.getLeft() - outline.getRight();
 
-                for (auto& line : m_lines)
+                for (auto& line : lines)
                 {
                     line.setPosition(0, 0);
 
@@ -444,6 +447,9 @@ namespace tgui
                 }
             }
         }
+
+        for (const auto& line : lines)
+            m_textVertices.addText(line);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,18 +473,17 @@ namespace tgui
             drawRectangleShape(target, states, innerSize, m_backgroundColorCached);
 
         // Apply clipping when needed
-        std::unique_ptr<Clipping> clipping;
         if (!m_autoSize)
         {
             innerSize.x -= m_paddingCached.getLeft() + m_paddingCached.getRight();
             innerSize.y -= m_paddingCached.getTop() + m_paddingCached.getBottom();
 
-            clipping = make_unique<Clipping>(target, states, sf::Vector2f{m_paddingCached.getLeft(), m_paddingCached.getTop()}, innerSize);
+            const Clipping clipping{target, states, sf::Vector2f{m_paddingCached.getLeft(), m_paddingCached.getTop()}, innerSize};
+            if (!clipping.isEmpty())
+                m_textVertices.draw(target, states);
         }
-
-        // Draw the text
-        for (const auto& line : m_lines)
-            line.draw(target, states);
+        else
+            m_textVertices.draw(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
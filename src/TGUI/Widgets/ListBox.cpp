@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -35,6 +37,7 @@ namespace tgui
     ListBox::ListBox()
     {
         m_type = "ListBox";
+        m_batchedDrawing = true;
 
         m_draggableWidget = true;
 
@@ -96,9 +99,6 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
-
         m_scroll.setPosition(getSize().x - m_bordersCached.getRight() - m_paddingCached.getRight() - m_scroll.getSize().x, m_bordersCached.getTop() + m_paddingCached.getTop());
     }
 
@@ -124,27 +124,23 @@ namespace tgui
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
         // Check if the item limit is reached (if there is one)
-        if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
+        if ((m_maxItems == 0) || (m_items.getSize() < m_maxItems))
         {
-            m_scroll.setMaximum(static_cast<unsigned int>((m_items.size() + 1) * m_itemHeight));
+            // Only the strings are stored, the text is created when the item becomes visible
+            m_items.add(itemName, id, m_itemHeight);
+            m_view.itemAdded(m_items);
+
+            // While a data source is set, the scrollbar belongs to its rows and the new item isn't shown
+            if (m_rowCache.getDataSource())
+                return true;
+
+            m_scroll.setMaximum(getTotalRowHeight());
 
             // Scroll down when auto-scrolling is enabled
             if (m_autoScroll && (m_scroll.getLowValue() < m_scroll.getMaximum()))
                 m_scroll.setValue(m_scroll.getMaximum() - m_scroll.getLowValue());
 
-            // Create the new item
-            Text newItem;
-            newItem.setFont(m_fontCached);
-            newItem.setColor(m_textColorCached);
-            newItem.setOpacity(m_opacityCached);
-            newItem.setStyle(m_textStyleCached);
-            newItem.setCharacterSize(m_textSize);
-            newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-            // Add the new item to the list
-            m_items.push_back(std::move(newItem));
-            m_itemIds.push_back(id);
+            invalidate();
             return true;
         }
         else // The item limit was reached
@@ -155,11 +151,13 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return setSelectedItemByIndex(i);
-        }
+        // The rows of a data source can only be selected by index
+        if (m_rowCache.getDataSource())
+            return false;
+
+        const std::size_t index = m_items.findText(itemName);
+        if (index != priv::IndexedItemList::NotFound)
+            return setSelectedItemByIndex(index);
 
         // No match was found
         deselectItem();
@@ -170,11 +168,13 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        // The rows of a data source can only be selected by index
+        if (m_rowCache.getDataSource())
+            return false;
+
+        const std::size_t index = m_items.findId(id);
+        if (index != priv::IndexedItemList::NotFound)
+            return setSelectedItemByIndex(index);
 
         // No match was found
         deselectItem();
@@ -185,7 +185,7 @@ namespace tgui
 
     bool ListBox::setSelectedItemByIndex(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= (m_rowCache.getDataSource() ? m_rowCache.getRowCount() : m_items.getSize()))
         {
             deselectItem();
             return false;
@@ -193,11 +193,23 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
-        // Move the scrollbar
-        if (m_selectedItem * getItemHeight() < m_scroll.getValue())
-            m_scroll.setValue(m_selectedItem * getItemHeight());
-        else if ((m_selectedItem + 1) * getItemHeight() > m_scroll.getValue() + m_scroll.getLowValue())
-            m_scroll.setValue((m_selectedItem + 1) * getItemHeight() - m_scroll.getLowValue());
+        // Move the scrollbar, unless the item is filtered out
+        const std::size_t row = findRow(index);
+        if (row != priv::IndexedItemList::NotFound)
+        {
+            const unsigned int itemTop = getRowTop(row);
+            const unsigned int itemBottom = itemTop + getRowHeight(index);
+            if (itemTop < m_scroll.getValue())
+            {
+                m_scroll.setValue(itemTop);
+                invalidate();
+            }
+            else if (itemBottom > m_scroll.getValue() + m_scroll.getLowValue())
+            {
+                m_scroll.setValue(itemBottom - m_scroll.getLowValue());
+                invalidate();
+            }
+        }
 
         return true;
     }
@@ -213,11 +225,9 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        const std::size_t index = m_items.findText(itemName);
+        if (index != priv::IndexedItemList::NotFound)
+            return removeItemByIndex(index);
 
         return false;
     }
@@ -226,11 +236,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        const std::size_t index = m_items.findId(id);
+        if (index != priv::IndexedItemList::NotFound)
+            return removeItemByIndex(index);
 
         return false;
     }
@@ -239,9 +247,17 @@ namespace tgui
 
     bool ListBox::removeItemByIndex(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= m_items.getSize())
             return false;
 
+        // The selection, hover and scrollbar belong to the rows of the data source while one is set
+        if (m_rowCache.getDataSource())
+        {
+            m_view.itemRemoved(index, m_items);
+            m_items.remove(index);
+            return true;
+        }
+
         // Keep it simple and forget hover when an item is removed
         updateHoveringItem(-1);
 
@@ -255,12 +271,13 @@ namespace tgui
         }
 
         // Remove the item
-        m_items.erase(m_items.begin() + index);
-        m_itemIds.erase(m_itemIds.begin() + index);
+        m_view.itemRemoved(index, m_items);
+        m_items.remove(index);
+        resetVisibleItems();
 
-        m_scroll.setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
+        m_scroll.setMaximum(getTotalRowHeight());
 
+        invalidate();
         return true;
     }
 
@@ -270,40 +287,45 @@ namespace tgui
     {
         // Clear the list, remove all items
         m_items.clear();
-        m_itemIds.clear();
+        m_view.itemsCleared();
+
+        // The selection, hover and scrollbar belong to the rows of the data source while one is set
+        if (m_rowCache.getDataSource())
+            return;
+
+        resetVisibleItems();
 
         // Unselect any selected item
         updateSelectedItem(-1);
         updateHoveringItem(-1);
 
-        m_scroll.setMaximum(0);
+        m_scroll.setMaximum(getTotalRowHeight());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
-
-        return "";
+        const std::size_t index = m_items.findId(id);
+        if (index != priv::IndexedItemList::NotFound)
+            return m_items[index].text.toString();
+        else
+            return "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? getItemText(m_selectedItem) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItemId() const
     {
-        return (m_selectedItem >= 0) ? m_itemIds[m_selectedItem] : "";
+        return (m_selectedItem >= 0) ? getItemId(m_selectedItem) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -317,11 +339,9 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        const std::size_t index = m_items.findText(originalValue);
+        if (index != priv::IndexedItemList::NotFound)
+            return changeItemByIndex(index, newValue);
 
         return false;
     }
@@ -330,11 +350,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const std::size_t index = m_items.findId(id);
+        if (index != priv::IndexedItemList::NotFound)
+            return changeItemByIndex(index, newValue);
 
         return false;
     }
@@ -343,10 +361,15 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
-        if (index >= m_items.size())
+        if (index >= m_items.getSize())
             return false;
 
-        m_items[index].setString(newValue);
+        m_items.setText(index, newValue);
+        m_view.itemTextChanged(index, m_items);
+        resetVisibleItems();
+
+        m_scroll.setMaximum(getTotalRowHeight());
+        invalidate();
         return true;
     }
 
@@ -354,7 +377,7 @@ namespace tgui
 
     std::size_t ListBox::getItemCount() const
     {
-        return m_items.size();
+        return m_items.getSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -362,17 +385,77 @@ namespace tgui
     std::vector<sf::String> ListBox::getItems() const
     {
         std::vector<sf::String> items;
-        for (const auto& item : m_items)
-            items.push_back(item.getString());
+        items.reserve(m_items.getSize());
+        for (std::size_t i = 0; i < m_items.getSize(); ++i)
+            items.push_back(m_items[i].text.toString());
 
         return items;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::vector<sf::String>& ListBox::getItemIds() const
+    std::vector<sf::String> ListBox::getItemIds() const
     {
-        return m_itemIds;
+        std::vector<sf::String> ids;
+        ids.reserve(m_items.getSize());
+        for (std::size_t i = 0; i < m_items.getSize(); ++i)
+            ids.push_back(m_items[i].id.toString());
+
+        return ids;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setSortComparator(std::function<bool(const sf::String& left, const sf::String& right)> comparator)
+    {
+        m_view.setComparator(std::move(comparator), m_items);
+        if (m_rowCache.getDataSource())
+            return;
+
+        updateHoveringItem(-1);
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilter(const sf::String& text)
+    {
+        m_view.setFilter(text, m_items);
+        if (m_rowCache.getDataSource())
+            return;
+
+        updateHoveringItem(-1);
+
+        m_scroll.setMaximum(getTotalRowHeight());
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilterPredicate(std::function<bool(const sf::String& item)> predicate)
+    {
+        m_view.setFilter(std::move(predicate), m_items);
+        if (m_rowCache.getDataSource())
+            return;
+
+        updateHoveringItem(-1);
+
+        m_scroll.setMaximum(getTotalRowHeight());
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ListBox::getFilter() const
+    {
+        return m_view.getFilterText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getShownItemCount() const
+    {
+        return getRowCount();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,15 +465,15 @@ namespace tgui
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
-        {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.setCharacterSize(m_textSize);
-        }
+
+        m_items.setAllHeights(m_itemHeight);
+        m_view.allHeightsChanged(m_items);
+        resetVisibleItems();
 
         m_scroll.setScrollAmount(m_itemHeight);
-        m_scroll.setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
+        m_scroll.setMaximum(getTotalRowHeight());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -402,6 +485,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::setItemHeightByIndex(std::size_t index, unsigned int itemHeight)
+    {
+        if (index >= m_items.getSize())
+            return false;
+
+        const unsigned int oldHeight = m_items.getHeight(index);
+        m_items.setHeight(index, itemHeight);
+        m_view.itemHeightChanged(index, oldHeight, m_items);
+        m_scroll.setMaximum(getTotalRowHeight());
+        invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListBox::getItemHeightByIndex(std::size_t index) const
+    {
+        if (index >= m_items.getSize())
+            return 0;
+
+        return m_items.getHeight(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setTextSize(unsigned int textSize)
     {
         m_requestedTextSize = textSize;
@@ -411,10 +519,8 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.setCharacterSize(m_textSize);
-
-        setPosition(m_position);
+        resetVisibleItems();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -432,14 +538,15 @@ namespace tgui
         m_maxItems = maximumItems;
 
         // Check if we already passed the limit
-        if ((m_maxItems > 0) && (m_maxItems < m_items.size()))
+        if ((m_maxItems > 0) && (m_maxItems < m_items.getSize()))
         {
             // Remove the items that passed the limitation
-            m_items.erase(m_items.begin() + m_maxItems, m_items.end());
-            m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            m_items.truncate(m_maxItems);
+            m_view.itemsTruncated(m_maxItems, m_items);
+            resetVisibleItems();
 
-            m_scroll.setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-            setPosition(m_position);
+            m_scroll.setMaximum(getTotalRowHeight());
+            invalidate();
         }
     }
 
@@ -466,6 +573,60 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::setDataSource(DataSource::Ptr dataSource)
+    {
+        updateSelectedItem(-1);
+        updateHoveringItem(-1);
+
+        m_rowCache.setDataSource(std::move(dataSource));
+        resetVisibleItems();
+
+        m_scroll.setMaximum(getTotalRowHeight());
+        m_scroll.setValue(0);
+
+        if (m_rowCache.getDataSource())
+            updateDataSourceRows();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataSource::Ptr ListBox::getDataSource() const
+    {
+        return m_rowCache.getDataSource();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setPrefetchDistance(std::size_t rowCount)
+    {
+        m_prefetchDistance = rowCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getPrefetchDistance() const
+    {
+        return m_prefetchDistance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setMaximumCachedRows(std::size_t rowCount)
+    {
+        m_rowCache.setMaximumRows(rowCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getMaximumCachedRows() const
+    {
+        return m_rowCache.getMaximumRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListBox::mouseOnWidget(sf::Vector2f pos) const
     {
         return sf::FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
@@ -481,7 +642,10 @@ namespace tgui
 
         if (m_scroll.mouseOnWidget(pos))
         {
+            const auto oldScrollState = m_scroll.getInteractionState();
             m_scroll.leftMousePressed(pos);
+            if (m_scroll.getInteractionState() != oldScrollState)
+                invalidate();
         }
         else
         {
@@ -490,14 +654,14 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll.getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll.getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const std::size_t hoveringRow = findRowAtOffset(m_scroll.getValue() + static_cast<unsigned int>(pos.y));
+                if (hoveringRow < getRowCount())
+                    updateHoveringItem(static_cast<int>(getItemIndex(hoveringRow)));
                 else
                     updateHoveringItem(-1);
 
                 if (m_hoveringItem >= 0)
-                    onMousePress.emit(this, m_items[m_hoveringItem].getString(), m_itemIds[m_hoveringItem]);
+                    onMousePress.emit(this, getItemText(m_hoveringItem), getItemId(m_hoveringItem));
 
                 if (m_selectedItem != m_hoveringItem)
                 {
@@ -516,7 +680,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll.isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onMouseRelease.emit(this, getItemText(m_selectedItem), getItemId(m_selectedItem));
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -524,7 +688,7 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                    onDoubleClick.emit(this, getItemText(m_selectedItem), getItemId(m_selectedItem));
             }
             else // This is the first click
             {
@@ -533,7 +697,10 @@ namespace tgui
             }
         }
 
+        const auto oldScrollState = m_scroll.getInteractionState();
         m_scroll.leftMouseReleased(pos - getPosition());
+        if (m_scroll.getInteractionState() != oldScrollState)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,7 +712,8 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
-        updateHoveringItem(-1);
+        const auto oldScrollState = m_scroll.getInteractionState();
+        int hoveringItem = -1;
 
         // Check if the mouse event should go to the scrollbar
         if ((m_scroll.isMouseDown() && m_scroll.isMouseDownOnThumb()) || m_scroll.mouseOnWidget(pos))
@@ -562,24 +730,27 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll.getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll.getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
-                else
-                    updateHoveringItem(-1);
+                const std::size_t hoveringRow = findRowAtOffset(m_scroll.getValue() + static_cast<unsigned int>(pos.y));
+                if (hoveringRow < getRowCount())
+                    hoveringItem = static_cast<int>(getItemIndex(hoveringRow));
 
                 // If the mouse is held down then select the item below the mouse
                 if (m_mouseDown && !m_scroll.isMouseDown())
                 {
-                    if (m_selectedItem != m_hoveringItem)
+                    if (m_selectedItem != hoveringItem)
                     {
                         m_possibleDoubleClick = false;
 
-                        updateSelectedItem(m_hoveringItem);
+                        updateSelectedItem(hoveringItem);
                     }
                 }
             }
         }
+
+        updateHoveringItem(hoveringItem);
+
+        if (m_scroll.getInteractionState() != oldScrollState)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -588,7 +759,10 @@ namespace tgui
     {
         if (m_scroll.isShown())
         {
+            const auto oldScrollState = m_scroll.getInteractionState();
             m_scroll.mouseWheelScrolled(delta, pos - getPosition());
+            if (m_scroll.getInteractionState() != oldScrollState)
+                invalidate();
 
             // Update on which item the mouse is hovering
             mouseMoved(pos);
@@ -600,7 +774,11 @@ namespace tgui
     void ListBox::mouseNoLongerOnWidget()
     {
         Widget::mouseNoLongerOnWidget();
+
+        const auto oldScrollState = m_scroll.getInteractionState();
         m_scroll.mouseNoLongerOnWidget();
+        if (m_scroll.getInteractionState() != oldScrollState)
+            invalidate();
 
         updateHoveringItem(-1);
 
@@ -612,7 +790,11 @@ namespace tgui
     void ListBox::mouseNoLongerDown()
     {
         Widget::mouseNoLongerDown();
+
+        const auto oldScrollState = m_scroll.getInteractionState();
         m_scroll.mouseNoLongerDown();
+        if (m_scroll.getInteractionState() != oldScrollState)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -627,6 +809,8 @@ namespace tgui
             return onMouseRelease;
         else if (signalName == toLower(onDoubleClick.getName()))
             return onDoubleClick;
+        else if (signalName == toLower(onRowsNeeded.getName()))
+            return onRowsNeeded;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -648,22 +832,18 @@ namespace tgui
         else if (property == "textcolor")
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
         }
         else if (property == "textcolorhover")
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
         }
         else if (property == "selectedtextcolor")
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
         }
         else if (property == "selectedtextcolorhover")
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
         }
         else if (property == "texturebackground")
         {
@@ -672,24 +852,10 @@ namespace tgui
         else if (property == "textstyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
         }
         else if (property == "selectedtextstyle")
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
         }
         else if (property == "scrollbar")
         {
@@ -721,25 +887,17 @@ namespace tgui
 
             m_scroll.setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.setOpacity(m_opacityCached);
+            resetVisibleItems();
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
-            {
                 m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
-            }
 
-            setPosition(m_position);
+            resetVisibleItems();
         }
         else
             Widget::rendererChanged(property);
@@ -754,83 +912,210 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    void ListBox::updateHoveringItem(int item)
     {
-        if (m_selectedItem >= 0)
+        if (m_hoveringItem != item)
         {
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorCached);
+            m_hoveringItem = item;
+            invalidate();
+        }
+    }
 
-            if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateSelectedItem(int item)
+    {
+        if (m_selectedItem != item)
+        {
+            m_selectedItem = item;
+            invalidate();
+
+            if (m_selectedItem >= 0)
+                onItemSelect.emit(this, getItemText(m_selectedItem), getItemId(m_selectedItem));
+            else
+                onItemSelect.emit(this, "", "");
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
+    void ListBox::resetVisibleItems()
+    {
+        m_visibleItemTexts.clear();
+        m_visibleItemIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getRowCount() const
+    {
+        if (m_rowCache.getDataSource())
+            return m_rowCache.getRowCount();
+        else
+            return m_view.getRowCount(m_items);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getItemIndex(std::size_t row) const
+    {
+        // The rows of a data source are never sorted or filtered
+        if (m_rowCache.getDataSource())
+            return row;
+        else
+            return m_view.getItemIndex(row, m_items);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::findRow(std::size_t index) const
+    {
+        if (m_rowCache.getDataSource())
+            return (index < m_rowCache.getRowCount()) ? index : priv::IndexedItemList::NotFound;
+        else
+            return m_view.findRow(index, m_items);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::findRowAtOffset(unsigned int offset) const
+    {
+        if (m_rowCache.getDataSource())
         {
-            if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].setColor(m_textColorHoverCached);
+            // All rows of a data source have the same height
+            if (m_itemHeight == 0)
+                return m_rowCache.getRowCount();
+            else
+                return std::min<std::size_t>(offset / m_itemHeight, m_rowCache.getRowCount());
         }
+        else
+            return m_view.findRowAtOffset(offset, m_items);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateItemColorsAndStyle()
+    unsigned int ListBox::getRowTop(std::size_t row) const
     {
-        for (auto& item : m_items)
+        if (m_rowCache.getDataSource())
+            return static_cast<unsigned int>(std::min(row, m_rowCache.getRowCount()) * m_itemHeight);
+        else
+            return m_view.getRowTop(row, m_items);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListBox::getRowHeight(std::size_t index) const
+    {
+        if (m_rowCache.getDataSource())
+            return m_itemHeight;
+        else
+            return m_items.getHeight(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListBox::getTotalRowHeight() const
+    {
+        if (m_rowCache.getDataSource())
+            return static_cast<unsigned int>(m_rowCache.getRowCount() * m_itemHeight);
+        else
+            return m_view.getTotalHeight(m_items);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ListBox::getItemText(std::size_t index) const
+    {
+        if (m_rowCache.getDataSource())
         {
-            item.setColor(m_textColorCached);
-            item.setStyle(m_textStyleCached);
+            // Rows that haven't been fetched yet are shown empty
+            const sf::String* row = m_rowCache.getRow(index);
+            return row ? *row : "";
         }
+        else
+            return m_items[index].text.toString();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+    sf::String ListBox::getItemId(std::size_t index) const
+    {
+        if (m_rowCache.getDataSource())
+            return "";
+        else
+            return m_items[index].id.toString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateHoveringItem(int item)
+    void ListBox::updateDataSourceRows()
     {
-        if (m_hoveringItem != item)
+        if (m_rowCache.updateRowCount())
         {
-            if (m_hoveringItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
-                else
-                    m_items[m_hoveringItem].setColor(m_textColorCached);
-            }
+            invalidate();
 
-            m_hoveringItem = item;
+            // Forget the selected and hovered rows when they no longer exist
+            if (m_selectedItem >= static_cast<int>(m_rowCache.getRowCount()))
+                updateSelectedItem(-1);
+            if (m_hoveringItem >= static_cast<int>(m_rowCache.getRowCount()))
+                updateHoveringItem(-1);
+
+            m_scroll.setMaximum(getTotalRowHeight());
+
+            // Scroll down when auto-scrolling is enabled
+            if (m_autoScroll && (m_scroll.getLowValue() < m_scroll.getMaximum()))
+                m_scroll.setValue(m_scroll.getMaximum() - m_scroll.getLowValue());
+        }
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+        // Load the visible rows, together with the rows that are close enough to be scrolled into view soon
+        const std::size_t rowCount = m_rowCache.getRowCount();
+        const std::size_t firstVisibleRow = findRowAtOffset(m_scroll.getValue());
+        const std::size_t lastVisibleRow = std::min(findRowAtOffset(m_scroll.getValue() + m_scroll.getLowValue()) + 1, rowCount);
+        const std::size_t firstRow = firstVisibleRow - std::min(firstVisibleRow, m_prefetchDistance);
+        const std::size_t lastRow = std::min(lastVisibleRow + m_prefetchDistance, rowCount);
+        if (m_rowCache.requestRows(firstRow, lastRow))
+            onRowsNeeded.emit(this, static_cast<int>(firstRow), static_cast<int>(lastRow - 1));
+
+        // The texts of the visible rows have to be updated when new rows arrived
+        if (m_rowCache.applyFetchedRows())
+        {
+            invalidate();
+            std::fill(m_visibleItemIndices.begin(), m_visibleItemIndices.end(), std::numeric_limits<std::size_t>::max());
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedItem(int item)
+    const Text& ListBox::getVisibleItemText(std::size_t row, std::size_t index) const
     {
-        if (m_selectedItem != item)
+        // Visible rows are consecutive, so as long as the pool is large enough they each map to a different text
+        const std::size_t slot = row % m_visibleItemTexts.size();
+        Text& text = m_visibleItemTexts[slot];
+        if (m_visibleItemIndices[slot] != index)
         {
-            if (m_selectedItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].setColor(m_textColorHoverCached);
-                else
-                    m_items[m_selectedItem].setColor(m_textColorCached);
+            text.setString(getItemText(index));
+            m_visibleItemIndices[slot] = index;
+        }
 
-                m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
+        Color color = m_textColorCached;
+        TextStyle style = m_textStyleCached;
+        if ((static_cast<int>(index) == m_hoveringItem) && m_textColorHoverCached.isSet())
+            color = m_textColorHoverCached;
 
-            m_selectedItem = item;
-            if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
-            else
-                onItemSelect.emit(this, "", "");
+        if (static_cast<int>(index) == m_selectedItem)
+        {
+            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
+                color = m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                color = m_selectedTextColorCached;
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+            if (m_selectedTextStyleCached.isSet())
+                style = m_selectedTextStyleCached;
         }
+
+        text.setColor(color);
+        text.setStyle(style);
+        return text;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -845,6 +1130,17 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        if (m_rowCache.getDataSource())
+            updateDataSourceRows();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time ListBox::getTimeUntilNextUpdate() const
+    {
+        // Rows that are being fetched have to be shown soon after they arrive
+        return std::min(Widget::getTimeUntilNextUpdate(), m_rowCache.getTimeUntilNextPoll());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -875,46 +1171,66 @@ namespace tgui
                 maxItemWidth -= m_scroll.getSize().x;
             const Clipping clipping{target, states, {m_paddingCached.getLeft(), m_paddingCached.getTop()}, {maxItemWidth, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
 
-            // Find out which items are visible
-            std::size_t firstItem = 0;
-            std::size_t lastItem = m_items.size();
+            // Find out which rows are visible
+            const unsigned int scrollValue = m_scroll.getValue();
+            const std::size_t rowCount = getRowCount();
+            std::size_t firstRow = 0;
+            std::size_t lastRow = rowCount;
             if (m_scroll.getLowValue() < m_scroll.getMaximum())
             {
-                firstItem = m_scroll.getValue() / m_itemHeight;
-                lastItem = (m_scroll.getValue() + m_scroll.getLowValue()) / m_itemHeight;
-
-                // Show another item when the scrollbar is standing between two items
-                if ((m_scroll.getValue() + m_scroll.getLowValue()) % m_itemHeight != 0)
-                    ++lastItem;
+                // The last visible row is the one containing the bottom pixel of the visible area
+                firstRow = findRowAtOffset(scrollValue);
+                if (m_scroll.getLowValue() > 0)
+                    lastRow = std::min(findRowAtOffset(scrollValue + m_scroll.getLowValue() - 1) + 1, rowCount);
+                else
+                    lastRow = firstRow;
             }
 
-            states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll.getValue()});
+            // The rows are positioned relative to the first visible one, as floats aren't precise enough for long lists
+            const unsigned int firstRowTop = getRowTop(firstRow);
+            states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - static_cast<float>(scrollValue - firstRowTop)});
 
-            // Draw the background of the selected item
-            if (m_selectedItem >= 0)
+            // Only the visible items have a text, the pool of texts grows when more items fit inside the list box
+            if (m_visibleItemTexts.size() < lastRow - firstRow)
             {
-                states.transform.translate({0, static_cast<float>(m_selectedItem * m_itemHeight)});
-
-                const sf::Vector2f size = {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)};
-                if ((m_selectedItem == m_hoveringItem) && m_selectedBackgroundColorHoverCached.isSet())
-                    drawRectangleShape(target, states, size, m_selectedBackgroundColorHoverCached);
-                else
-                    drawRectangleShape(target, states, size, m_selectedBackgroundColorCached);
-
-                states.transform.translate({0, -static_cast<float>(m_selectedItem * m_itemHeight)});
+                m_visibleItemTexts.assign(lastRow - firstRow, {});
+                m_visibleItemIndices.assign(lastRow - firstRow, std::numeric_limits<std::size_t>::max());
+                for (auto& text : m_visibleItemTexts)
+                {
+                    text.setFont(m_fontCached);
+                    text.setOpacity(m_opacityCached);
+                    text.setCharacterSize(m_textSize);
+                }
             }
 
-            // Draw the background of the item on which the mouse is standing
-            if ((m_hoveringItem >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
+            // Draw the items, together with the background of the selected item and the one on which the mouse is standing
+            const float backgroundWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+            float itemTop = 0;
+            for (std::size_t row = firstRow; row < lastRow; ++row)
             {
-                states.transform.translate({0, static_cast<float>(m_hoveringItem * m_itemHeight)});
-                drawRectangleShape(target, states, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
-                states.transform.translate({0, -static_cast<float>(m_hoveringItem * m_itemHeight)});
-            }
+                const std::size_t index = getItemIndex(row);
+                const unsigned int itemHeight = getRowHeight(index);
+
+                sf::RenderStates itemStates = states;
+                itemStates.transform.translate({0, itemTop});
+
+                const sf::Vector2f backgroundSize = {backgroundWidth, static_cast<float>(itemHeight)};
+                if (static_cast<int>(index) == m_selectedItem)
+                {
+                    if ((m_selectedItem == m_hoveringItem) && m_selectedBackgroundColorHoverCached.isSet())
+                        drawRectangleShape(target, itemStates, backgroundSize, m_selectedBackgroundColorHoverCached);
+                    else
+                        drawRectangleShape(target, itemStates, backgroundSize, m_selectedBackgroundColorCached);
+                }
+                else if ((static_cast<int>(index) == m_hoveringItem) && m_backgroundColorHoverCached.isSet())
+                    drawRectangleShape(target, itemStates, backgroundSize, m_backgroundColorHoverCached);
 
-            // Draw the items
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+                const Text& text = getVisibleItemText(row, index);
+                itemStates.transform.translate({0, (itemHeight - text.getSize().y) / 2.0f});
+                text.draw(target, itemStates);
+
+                itemTop += itemHeight;
+            }
         }
 
         // Draw the scrollbar
@@ -36,6 +36,8 @@ namespace tgui
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
+        m_batchedDrawing = true;
+        m_allowCulling = false;
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -110,6 +112,7 @@ namespace tgui
         newMenu.text.setCharacterSize(m_textSize);
         newMenu.text.setString(text);
         m_menus.push_back(std::move(newMenu));
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +133,11 @@ namespace tgui
                 menuItem.setString(text);
 
                 m_menus[i].menuItems.push_back(std::move(menuItem));
+
+                // The items are only drawn while their menu is open
+                if (m_visibleMenu == static_cast<int>(i))
+                    invalidate();
+
                 return true;
             }
         }
@@ -164,6 +172,7 @@ namespace tgui
                 if (m_visibleMenu == static_cast<int>(i))
                     m_visibleMenu = -1;
 
+                invalidate();
                 return true;
             }
         }
@@ -193,6 +202,9 @@ namespace tgui
                         if (m_menus[i].selectedMenuItem == static_cast<int>(j))
                             m_menus[i].selectedMenuItem = -1;
 
+                        if (m_visibleMenu == static_cast<int>(i))
+                            invalidate();
+
                         return true;
                     }
                 }
@@ -208,6 +220,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -223,6 +236,8 @@ namespace tgui
 
             m_menus[i].text.setCharacterSize(m_textSize);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -237,6 +252,9 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
         m_minimumSubMenuWidth = minimumWidth;
+
+        if (m_visibleMenu != -1)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,6 +269,9 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+
+        if (m_visibleMenu != -1)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -294,6 +315,7 @@ namespace tgui
 
             m_menus[m_visibleMenu].text.setColor(m_textColorCached);
             m_visibleMenu = -1;
+            invalidate();
         }
     }
 
@@ -374,6 +396,7 @@ namespace tgui
 
                         m_menus[m_visibleMenu].text.setColor(m_textColorCached);
                         m_visibleMenu = -1;
+                        invalidate();
                     }
 
                     // If this menu can be opened then do so
@@ -385,6 +408,7 @@ namespace tgui
                             m_menus[i].text.setColor(m_textColorCached);
 
                         m_visibleMenu = static_cast<int>(i);
+                        invalidate();
                     }
 
                     break;
@@ -454,11 +478,12 @@ namespace tgui
                             {
                                 m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
                                 m_menus[m_visibleMenu].selectedMenuItem = -1;
+                                invalidate();
                             }
                         }
                         else // The menu isn't open yet
                         {
-                            // If there is another menu open then close it first
+                            // If there is another menu open then close it first, which also redraws the menu bar
                             closeMenu();
 
                             // If this menu can be opened then do so
@@ -499,6 +524,8 @@ namespace tgui
                     m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
                 else
                     m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
+
+                invalidate();
             }
         }
     }
@@ -524,6 +551,7 @@ namespace tgui
             m_menus[m_visibleMenu].selectedMenuItem = -1;
         }
 
+        // The base class redraws the menu bar
         Widget::mouseLeftWidget();
     }
 
@@ -58,7 +58,7 @@ namespace tgui
 
         for (unsigned int i = 0; i < m_widgets.size(); ++i)
         {
-            if ((m_widgetNames[i].getSize() >= 32) && (m_widgetNames[i].substring(0, 32) == "#TGUI_INTERNAL$MessageBoxButton:"))
+            if (m_widgetNames[i].startsWith("#TGUI_INTERNAL$MessageBoxButton:"))
             {
                 auto button = std::dynamic_pointer_cast<Button>(m_widgets[i]);
 
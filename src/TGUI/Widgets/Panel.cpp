@@ -203,7 +203,7 @@ namespace tgui
 
         // Draw the child widgets
         const Clipping clipping{target, states, {}, contentSize};
-        drawWidgetContainer(&target, states);
+        drawCachedWidgetContainer(&target, states, contentSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
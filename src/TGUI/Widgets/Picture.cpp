@@ -34,6 +34,7 @@ namespace tgui
     Picture::Picture()
     {
         m_type = "Picture";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<PictureRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
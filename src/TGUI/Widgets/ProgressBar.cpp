@@ -35,6 +35,7 @@ namespace tgui
     ProgressBar::ProgressBar()
     {
         m_type = "ProgressBar";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<ProgressBarRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -121,6 +122,7 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +149,7 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,6 +180,7 @@ namespace tgui
 
             // Recalculate the size of the front image (the size of the part that will be drawn)
             recalculateFillSize();
+            invalidate();
         }
     }
 
@@ -229,6 +233,7 @@ namespace tgui
         }
 
         m_textFront.setCharacterSize(m_textBack.getCharacterSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -260,6 +265,7 @@ namespace tgui
     {
         m_fillDirection = direction;
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
@@ -34,6 +35,7 @@ namespace tgui
     RadioButton::RadioButton()
     {
         m_type = "RadioButton";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<RadioButtonRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -139,6 +141,7 @@ namespace tgui
                 m_text.setStyle(m_textStyleCheckedCached);
             else
                 m_text.setStyle(m_textStyleCached);
+            invalidate();
 
             onCheck.emit(this, true);
         }
@@ -154,6 +157,7 @@ namespace tgui
 
             updateTextColor();
             m_text.setStyle(m_textStyleCached);
+            invalidate();
 
             onUncheck.emit(this, false);
         }
@@ -171,6 +175,8 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -616,6 +622,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(sf::Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
+            priv::RenderBatch::flushActive(target);
             target.draw(circle, states);
         }
 
@@ -650,6 +657,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
+            priv::RenderBatch::flushActive(target);
             target.draw(circle, states);
 
             // Draw the check if the radio button is checked
@@ -34,6 +34,7 @@ namespace tgui
     RadioButtonGroup::RadioButtonGroup()
     {
         m_type = "RadioButtonGroup";
+        m_batchedDrawing = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
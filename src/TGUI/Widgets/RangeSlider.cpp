@@ -34,6 +34,7 @@ namespace tgui
     RangeSlider::RangeSlider()
     {
         m_type = "RangeSlider";
+        m_batchedDrawing = true;
 
         m_draggableWidget = true;
 
@@ -212,6 +213,7 @@ namespace tgui
             setSelectionStart(m_selectionStart);
 
         updateThumbPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,6 +243,7 @@ namespace tgui
             setSelectionEnd(m_selectionEnd);
 
         updateThumbPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,6 +274,7 @@ namespace tgui
             onRangeChange.emit(this, m_selectionStart, m_selectionEnd);
 
             updateThumbPositions();
+            invalidate();
         }
     }
 
@@ -302,6 +306,7 @@ namespace tgui
             onRangeChange.emit(this, m_selectionStart, m_selectionEnd);
 
             updateThumbPositions();
+            invalidate();
         }
     }
 
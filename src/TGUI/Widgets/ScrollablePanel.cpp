@@ -161,6 +161,7 @@ namespace tgui
             recalculateMostBottomRightPosition();
 
         updateScrollbars();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,6 +189,9 @@ namespace tgui
     {
         m_mouseDown = true;
 
+        const auto oldVerticalScrollState = m_verticalScrollbar.getInteractionState();
+        const auto oldHorizontalScrollState = m_horizontalScrollbar.getInteractionState();
+
         if (m_verticalScrollbar.mouseOnWidget(pos - getPosition()))
             m_verticalScrollbar.leftMousePressed(pos - getPosition());
         else if (m_horizontalScrollbar.mouseOnWidget(pos - getPosition()))
@@ -197,12 +201,18 @@ namespace tgui
             Panel::leftMousePressed({pos.x + static_cast<float>(m_horizontalScrollbar.getValue()),
                                      pos.y + static_cast<float>(m_verticalScrollbar.getValue())});
         }
+
+        if ((m_verticalScrollbar.getInteractionState() != oldVerticalScrollState) || (m_horizontalScrollbar.getInteractionState() != oldHorizontalScrollState))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollablePanel::leftMouseReleased(sf::Vector2f pos)
     {
+        const auto oldVerticalScrollState = m_verticalScrollbar.getInteractionState();
+        const auto oldHorizontalScrollState = m_horizontalScrollbar.getInteractionState();
+
         if (m_verticalScrollbar.mouseOnWidget(pos - getPosition()))
             m_verticalScrollbar.leftMouseReleased(pos - getPosition());
         else if (m_horizontalScrollbar.mouseOnWidget(pos - getPosition()))
@@ -212,21 +222,23 @@ namespace tgui
             Panel::leftMouseReleased({pos.x + static_cast<float>(m_horizontalScrollbar.getValue()),
                                       pos.y + static_cast<float>(m_verticalScrollbar.getValue())});
         }
+
+        if ((m_verticalScrollbar.getInteractionState() != oldVerticalScrollState) || (m_horizontalScrollbar.getInteractionState() != oldHorizontalScrollState))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollablePanel::mouseMoved(sf::Vector2f pos)
     {
+        const auto oldVerticalScrollState = m_verticalScrollbar.getInteractionState();
+        const auto oldHorizontalScrollState = m_horizontalScrollbar.getInteractionState();
+
         // Check if the mouse event should go to the scrollbar
         if ((m_verticalScrollbar.isMouseDown() && m_verticalScrollbar.isMouseDownOnThumb()) || m_verticalScrollbar.mouseOnWidget(pos - getPosition()))
-        {
             m_verticalScrollbar.mouseMoved(pos - getPosition());
-        }
         else if ((m_horizontalScrollbar.isMouseDown() && m_horizontalScrollbar.isMouseDownOnThumb()) || m_horizontalScrollbar.mouseOnWidget(pos - getPosition()))
-        {
             m_horizontalScrollbar.mouseMoved(pos - getPosition());
-        }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
             if (sf::FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
@@ -238,12 +250,18 @@ namespace tgui
             m_verticalScrollbar.mouseNoLongerOnWidget();
             m_horizontalScrollbar.mouseNoLongerOnWidget();
         }
+
+        if ((m_verticalScrollbar.getInteractionState() != oldVerticalScrollState) || (m_horizontalScrollbar.getInteractionState() != oldHorizontalScrollState))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollablePanel::mouseWheelScrolled(float delta, sf::Vector2f pos)
     {
+        const auto oldVerticalScrollState = m_verticalScrollbar.getInteractionState();
+        const auto oldHorizontalScrollState = m_horizontalScrollbar.getInteractionState();
+
         if (m_horizontalScrollbar.isShown() && m_horizontalScrollbar.mouseOnWidget(pos - getPosition()))
         {
             m_horizontalScrollbar.mouseWheelScrolled(delta, pos - getPosition());
@@ -254,6 +272,9 @@ namespace tgui
             m_verticalScrollbar.mouseWheelScrolled(delta, pos - getPosition());
             mouseMoved(pos);
         }
+
+        if ((m_verticalScrollbar.getInteractionState() != oldVerticalScrollState) || (m_horizontalScrollbar.getInteractionState() != oldHorizontalScrollState))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,8 +282,14 @@ namespace tgui
     void ScrollablePanel::mouseNoLongerOnWidget()
     {
         Panel::mouseNoLongerOnWidget();
+
+        const auto oldVerticalScrollState = m_verticalScrollbar.getInteractionState();
+        const auto oldHorizontalScrollState = m_horizontalScrollbar.getInteractionState();
         m_verticalScrollbar.mouseNoLongerOnWidget();
         m_horizontalScrollbar.mouseNoLongerOnWidget();
+
+        if ((m_verticalScrollbar.getInteractionState() != oldVerticalScrollState) || (m_horizontalScrollbar.getInteractionState() != oldHorizontalScrollState))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,8 +297,14 @@ namespace tgui
     void ScrollablePanel::mouseNoLongerDown()
     {
         Panel::mouseNoLongerDown();
+
+        const auto oldVerticalScrollState = m_verticalScrollbar.getInteractionState();
+        const auto oldHorizontalScrollState = m_horizontalScrollbar.getInteractionState();
         m_verticalScrollbar.mouseNoLongerDown();
         m_horizontalScrollbar.mouseNoLongerDown();
+
+        if ((m_verticalScrollbar.getInteractionState() != oldVerticalScrollState) || (m_horizontalScrollbar.getInteractionState() != oldHorizontalScrollState))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,10 +340,9 @@ namespace tgui
         {
             const Clipping clipping{target, states, {}, contentSize};
 
-            states.transform.translate(-static_cast<float>(m_horizontalScrollbar.getValue()),
-                                       -static_cast<float>(m_verticalScrollbar.getValue()));
-
-            drawWidgetContainer(&target, states);
+            const sf::Vector2f scrollOffset{-static_cast<float>(m_horizontalScrollbar.getValue()),
+                                            -static_cast<float>(m_verticalScrollbar.getValue())};
+            drawCachedWidgetContainer(&target, states, contentSize, scrollOffset);
         }
 
         m_verticalScrollbar.draw(target, oldStates);
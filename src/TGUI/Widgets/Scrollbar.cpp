@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +36,7 @@ namespace tgui
     Scrollbar::Scrollbar()
     {
         m_type = "Scrollbar";
+        m_batchedDrawing = true;
 
         m_draggableWidget = true;
 
@@ -228,6 +230,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        const unsigned int oldMaximum = m_maximum;
+
         // Set the new maximum
         if (maximum > 0)
             m_maximum = maximum;
@@ -242,6 +246,9 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         setSize(m_size);
+
+        if (m_maximum != oldMaximum)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,10 +272,11 @@ namespace tgui
         {
             m_value = value;
 
-            onValueChange.emit(this, m_value);
-
             // Recalculate the size and position of the thumb image
             setSize(m_size);
+            invalidate();
+
+            onValueChange.emit(this, m_value);
         }
     }
 
@@ -283,6 +291,8 @@ namespace tgui
 
     void Scrollbar::setLowValue(unsigned int lowValue)
     {
+        const unsigned int oldLowValue = m_lowValue;
+
         // Set the new value
         m_lowValue = lowValue;
 
@@ -294,6 +304,9 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         setSize(m_size);
+
+        if (m_lowValue != oldLowValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -321,7 +334,11 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
-        m_autoHide = autoHide;
+        if (m_autoHide != autoHide)
+        {
+            m_autoHide = autoHide;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,6 +508,9 @@ namespace tgui
     {
         pos -= getPosition();
 
+        const Part oldMouseHoverOverPart = m_mouseHoverOverPart;
+        const sf::Vector2f oldThumbPosition{m_thumb.left, m_thumb.top};
+
         if (!m_mouseHover)
             mouseEnteredWidget();
 
@@ -647,6 +667,10 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (sf::FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(pos))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        // The thumb follows the mouse while it is dragged, even when the value doesn't change
+        if ((m_mouseHoverOverPart != oldMouseHoverOverPart) || (sf::Vector2f{m_thumb.left, m_thumb.top} != oldThumbPosition))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -784,6 +808,8 @@ namespace tgui
 
     void Scrollbar::updateThumbPosition()
     {
+        const sf::Vector2f oldThumbPosition{m_thumb.left, m_thumb.top};
+
         if (m_verticalScroll)
         {
             m_thumb.left = 0;
@@ -794,6 +820,9 @@ namespace tgui
             m_thumb.left = m_track.left + ((m_track.width - m_thumb.width) * m_value / (m_maximum - m_lowValue));
             m_thumb.top = 0;
         }
+
+        if (sf::Vector2f{m_thumb.left, m_thumb.top} != oldThumbPosition)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -844,6 +873,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
+            priv::RenderBatch::flushActive(target);
             target.draw(arrow, states);
         }
 
@@ -918,6 +948,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
+            priv::RenderBatch::flushActive(target);
             target.draw(arrow, states);
         }
     }
@@ -945,6 +976,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::tuple<unsigned int, bool, int, float, float> ScrollbarChildWidget::getInteractionState() const
+    {
+        return std::make_tuple(m_value, m_mouseHover, static_cast<int>(m_mouseHoverOverPart), m_thumb.left, m_thumb.top);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,7 @@ namespace tgui
     Slider::Slider()
     {
         m_type = "Slider";
+        m_batchedDrawing = true;
 
         m_draggableWidget = true;
 
@@ -205,6 +206,7 @@ namespace tgui
             setValue(m_minimum);
 
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -230,6 +232,7 @@ namespace tgui
             setValue(m_maximum);
 
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -256,6 +259,7 @@ namespace tgui
             onValueChange.emit(this, m_value);
 
             updateThumbPosition();
+            invalidate();
         }
     }
 
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
@@ -35,6 +36,7 @@ namespace tgui
     SpinButton::SpinButton()
     {
         m_type = "SpinButton";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<SpinButtonRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -198,6 +200,7 @@ namespace tgui
         }
 
         setSize(m_size);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,6 +280,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(sf::Vector2f pos)
     {
+        const bool oldMouseHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -293,6 +298,9 @@ namespace tgui
                 m_mouseHoverOnTopArrow = false;
         }
 
+        if (m_mouseHoverOnTopArrow != oldMouseHoverOnTopArrow)
+            invalidate();
+
         if (!m_mouseHover)
             mouseEnteredWidget();
     }
@@ -445,6 +453,7 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
+            priv::RenderBatch::flushActive(target);
             target.draw(arrowBack, states);
             target.draw(arrow, states);
         }
@@ -511,6 +520,7 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
+            priv::RenderBatch::flushActive(target);
             target.draw(arrowBack, states);
             target.draw(arrow, states);
         }
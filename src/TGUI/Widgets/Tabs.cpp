@@ -35,6 +35,7 @@ namespace tgui
     Tabs::Tabs()
     {
         m_type = "Tabs";
+        m_batchedDrawing = true;
 
         m_renderer = aurora::makeCopied<TabsRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -106,6 +107,7 @@ namespace tgui
         {
             m_autoSize = autoSize;
             recalculateTabsWidth();
+            invalidate();
         }
     }
 
@@ -152,9 +154,11 @@ namespace tgui
         if (m_selectedTab >= static_cast<int>(index))
             m_selectedTab++;
 
-        // If the tab has to be selected then do so
+        // If the tab has to be selected then do so, selecting it already redraws the tabs
         if (selectTab)
             select(index);
+        else
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +180,7 @@ namespace tgui
 
         m_tabTexts[index].setString(text);
         recalculateTabsWidth();
+        invalidate();
 
         return true;
     }
@@ -212,6 +217,7 @@ namespace tgui
         // Select the tab
         m_selectedTab = static_cast<int>(index);
         m_tabTexts[m_selectedTab].setColor(m_selectedTextColorCached);
+        invalidate();
 
         // Send the callback
         onTabSelect.emit(this, m_tabTexts[index].getString());
@@ -222,9 +228,11 @@ namespace tgui
     void Tabs::deselect()
     {
         if (m_selectedTab >= 0)
+        {
             m_tabTexts[m_selectedTab].setColor(m_textColorCached);
-
-        m_selectedTab = -1;
+            m_selectedTab = -1;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,6 +269,8 @@ namespace tgui
 
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -273,6 +283,7 @@ namespace tgui
         m_hoveringTab = -1;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -309,6 +320,7 @@ namespace tgui
                 text.setCharacterSize(m_textSize);
 
             recalculateTabsWidth();
+            invalidate();
         }
     }
 
@@ -338,6 +350,7 @@ namespace tgui
         m_maximumTabWidth = maximumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -354,6 +367,7 @@ namespace tgui
         m_minimumTabWidth = minimumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -407,6 +421,7 @@ namespace tgui
         Widget::mouseMoved(pos);
 
         pos -= getPosition();
+        const int oldHoveringTab = m_hoveringTab;
         m_hoveringTab = -1;
         float width = m_bordersCached.getLeft() / 2.f;
 
@@ -423,6 +438,9 @@ namespace tgui
                 break;
             }
         }
+
+        if (m_hoveringTab != oldHoveringTab)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -653,15 +671,22 @@ namespace tgui
                 states.transform.translate({(m_bordersCached.getLeft() + m_bordersCached.getRight()) / 2.f, 0});
             }
 
-            // Apply clipping if required for the text in this tab
-            std::unique_ptr<Clipping> clipping;
+            // Draw the text centered in the tab
             const float usableWidth = m_tabWidth[i] - (2 * m_distanceToSideCached);
-            if (m_tabTexts[i].getSize().x > usableWidth)
-                clipping = make_unique<Clipping>(target, textStates, sf::Vector2f{m_distanceToSideCached, 0}, sf::Vector2f{usableWidth, usableHeight});
+            const auto drawText = [&](){
+                textStates.transform.translate({m_distanceToSideCached + ((usableWidth - m_tabTexts[i].getSize().x) / 2.f), ((usableHeight - m_tabTexts[i].getSize().y) / 2.f)});
+                m_tabTexts[i].draw(target, textStates);
+            };
 
-            // Draw the text
-            textStates.transform.translate({m_distanceToSideCached + ((usableWidth - m_tabTexts[i].getSize().x) / 2.f), ((usableHeight - m_tabTexts[i].getSize().y) / 2.f)});
-            m_tabTexts[i].draw(target, textStates);
+            // Apply clipping if required for the text in this tab
+            if (m_tabTexts[i].getSize().x > usableWidth)
+            {
+                const Clipping clipping{target, textStates, sf::Vector2f{m_distanceToSideCached, 0}, sf::Vector2f{usableWidth, usableHeight}};
+                if (!clipping.isEmpty())
+                    drawText();
+            }
+            else
+                drawText();
         }
     }
 
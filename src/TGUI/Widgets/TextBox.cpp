@@ -27,6 +27,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/TextRelayoutPass.hpp>
+#include <TGUI/GlyphMetrics.hpp>
 
 #include <cmath>
 
@@ -39,6 +41,7 @@ namespace tgui
     TextBox::TextBox()
     {
         m_type = "TextBox";
+        m_batchedDrawing = true;
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<TextBoxRenderer>();
@@ -306,8 +309,12 @@ namespace tgui
         // If there is a scrollbar then pass the event
         if ((m_verticalScroll.isShown()) && (m_verticalScroll.mouseOnWidget(pos)))
         {
+            const auto oldScrollState = m_verticalScroll.getInteractionState();
             m_verticalScroll.leftMousePressed(pos);
             recalculateVisibleLines();
+
+            if (m_verticalScroll.getInteractionState() != oldScrollState)
+                invalidate();
         }
         else // The click occurred on the text box
         {
@@ -375,7 +382,12 @@ namespace tgui
             updateSelectionTexts();
 
             // The caret should be visible
-            m_caretVisible = true;
+            if (!m_caretVisible)
+            {
+                m_caretVisible = true;
+                invalidate();
+            }
+
             m_animationTimeElapsed = {};
         }
     }
@@ -390,8 +402,12 @@ namespace tgui
             // Only pass the event when the scrollbar still thinks the mouse is down
             if (m_verticalScroll.isMouseDown())
             {
+                const auto oldScrollState = m_verticalScroll.getInteractionState();
                 m_verticalScroll.leftMouseReleased(pos - getPosition());
                 recalculateVisibleLines();
+
+                if (m_verticalScroll.getInteractionState() != oldScrollState)
+                    invalidate();
             }
         }
     }
@@ -408,6 +424,8 @@ namespace tgui
         // The mouse has moved so a double click is no longer possible
         m_possibleDoubleClick = false;
 
+        const auto oldScrollState = m_verticalScroll.getInteractionState();
+
         // Check if the mouse event should go to the scrollbar
         if (m_verticalScroll.isShown() && ((m_verticalScroll.isMouseDown() && m_verticalScroll.isMouseDownOnThumb()) || m_verticalScroll.mouseOnWidget(pos)))
         {
@@ -436,6 +454,9 @@ namespace tgui
                 recalculateVisibleLines();
             }
         }
+
+        if (m_verticalScroll.getInteractionState() != oldScrollState)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -446,7 +467,12 @@ namespace tgui
             mouseLeftWidget();
 
         if (m_verticalScroll.isShown())
+        {
+            const auto oldScrollState = m_verticalScroll.getInteractionState();
             m_verticalScroll.mouseNoLongerOnWidget();
+            if (m_verticalScroll.getInteractionState() != oldScrollState)
+                invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -456,7 +482,12 @@ namespace tgui
         Widget::mouseNoLongerDown();
 
         if (m_verticalScroll.isShown())
+        {
+            const auto oldScrollState = m_verticalScroll.getInteractionState();
             m_verticalScroll.mouseNoLongerDown();
+            if (m_verticalScroll.getInteractionState() != oldScrollState)
+                invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -849,7 +880,12 @@ namespace tgui
         }
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidate();
+        }
+
         m_animationTimeElapsed = {};
     }
 
@@ -906,7 +942,12 @@ namespace tgui
         }
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidate();
+        }
+
         m_animationTimeElapsed = {};
 
         onTextChange.emit(this, m_text);
@@ -918,8 +959,12 @@ namespace tgui
     {
         if (m_verticalScroll.isShown())
         {
+            const auto oldScrollState = m_verticalScroll.getInteractionState();
             m_verticalScroll.mouseWheelScrolled(delta, pos - getPosition());
             recalculateVisibleLines();
+
+            if (m_verticalScroll.getInteractionState() != oldScrollState)
+                invalidate();
         }
     }
 
@@ -985,6 +1030,7 @@ namespace tgui
             return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
 
         // Find between which character the mouse is standing
+        priv::GlyphMetrics& metrics = priv::GlyphMetrics::get(m_fontCached.getFont(), getTextSize(), false);
         float width = 0;
         sf::Uint32 prevChar = 0;
         for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
@@ -994,12 +1040,9 @@ namespace tgui
             //if (curChar == '\n')
             //    return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
             //else
-            if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+            charWidth = metrics.getAdvance(curChar); // A tab is as wide as 4 spaces
 
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, getTextSize()));
+            const float kerning = metrics.getKerning(prevChar, curChar);
             if (width + charWidth + kerning <= position.x)
                 width += charWidth + kerning;
             else
@@ -1083,24 +1126,24 @@ namespace tgui
         if (keepSelection)
             textSelectionPositions = findTextSelectionPositions();
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
+        // Fit the text in the available space. Only the paragraphs that are affected by the change are wrapped again.
+        m_wordWrapper.setFont(m_fontCached, m_textSize, false);
+        m_wordWrapper.setDropLeadingSpace(false);
+        m_wordWrapper.setText(m_text);
+        m_wordWrapper.setMaximumWidth(maxLineWidth);
 
-        // Split the string in multiple lines
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
+        // During a relayout pass the text is wrapped on a worker thread and the lines are only updated when the pass ends
+        TextRelayoutPass::requestWrap(m_wordWrapper, [this,keepSelection,textSelectionPositions](){ updateLines(keepSelection, textSelectionPositions); });
+    }
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            searchPosStart = newLinePos + 1;
-        }
+    void TextBox::updateLines(bool keepSelection, std::pair<std::size_t, std::size_t> textSelectionPositions)
+    {
+        // Split the string in multiple lines
+        m_lines.clear();
+        for (const auto& line : m_wordWrapper.getLines())
+            m_lines.push_back(m_text.substring(line.begin, line.end - line.begin));
 
         // Check if we should try to keep our selection
         if (keepSelection)
@@ -1251,6 +1294,7 @@ namespace tgui
         }
 
         recalculatePositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1275,6 +1319,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1283,6 +1329,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time TextBox::getTimeUntilNextUpdate() const
+    {
+        // The caret only blinks while the widget is focused
+        if (!m_focused)
+            return Widget::getTimeUntilNextUpdate();
+
+        const sf::Time timeUntilCaretBlink = std::max(sf::Time::Zero, sf::milliseconds(500) - m_animationTimeElapsed);
+        return std::min(Widget::getTimeUntilNextUpdate(), timeUntilCaretBlink);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::recalculatePositions()
     {
         if (!m_fontCached)
@@ -1380,11 +1438,27 @@ namespace tgui
             }
         }
 
+        updateTextVertices();
         recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateTextVertices()
+    {
+        m_textVertices.clear();
+        m_textVertices.addText(m_textBeforeSelection);
+        if (m_selStart != m_selEnd)
+        {
+            m_textVertices.addText(m_textSelection1);
+            m_textVertices.addText(m_textSelection2);
+            m_textVertices.addText(m_textAfterSelection1);
+            m_textVertices.addText(m_textAfterSelection2);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::recalculateVisibleLines()
     {
         m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
@@ -1436,11 +1510,13 @@ namespace tgui
             m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+            updateTextVertices();
         }
         else if (property == "selectedtextcolor")
         {
             m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
             m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+            updateTextVertices();
         }
         else if (property == "texturebackground")
         {
@@ -1481,6 +1557,7 @@ namespace tgui
             m_textAfterSelection2.setOpacity(m_opacityCached);
             m_textSelection1.setOpacity(m_opacityCached);
             m_textSelection2.setOpacity(m_opacityCached);
+            updateTextVertices();
         }
         else if (property == "font")
         {
@@ -1540,14 +1617,7 @@ namespace tgui
             }
 
             // Draw the text
-            m_textBeforeSelection.draw(target, states);
-            if (m_selStart != m_selEnd)
-            {
-                m_textSelection1.draw(target, states);
-                m_textSelection2.draw(target, states);
-                m_textAfterSelection1.draw(target, states);
-                m_textAfterSelection2.draw(target, states);
-            }
+            m_textVertices.draw(target, states);
 
             // Only draw the caret when needed
             if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
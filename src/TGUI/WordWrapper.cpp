@@ -0,0 +1,463 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/WordWrapper.hpp>
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/TextRelayoutPass.hpp>
+#include <TGUI/Global.hpp>
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WordWrapper::WordWrapper(const WordWrapper& other) :
+            m_text                 {other.m_text},
+            m_font                 {other.m_font},
+            m_textSize             {other.m_textSize},
+            m_bold                 {other.m_bold},
+            m_dropLeadingSpace     {other.m_dropLeadingSpace},
+            m_maxWidth             {other.m_maxWidth},
+            m_paragraphs           {other.m_paragraphs},
+            m_lines                {other.m_lines},
+            m_linesNeedUpdate      {other.m_linesNeedUpdate},
+            m_wrappedParagraphCount{other.m_wrappedParagraphCount},
+            m_metrics              {nullptr},
+            m_relayoutQueued       {false},
+            m_relayoutJob          {0}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WordWrapper::WordWrapper(WordWrapper&& other) :
+            m_text                 {std::move(other.m_text)},
+            m_font                 {std::move(other.m_font)},
+            m_textSize             {std::move(other.m_textSize)},
+            m_bold                 {std::move(other.m_bold)},
+            m_dropLeadingSpace     {std::move(other.m_dropLeadingSpace)},
+            m_maxWidth             {std::move(other.m_maxWidth)},
+            m_paragraphs           {std::move(other.m_paragraphs)},
+            m_lines                {std::move(other.m_lines)},
+            m_linesNeedUpdate      {std::move(other.m_linesNeedUpdate)},
+            m_wrappedParagraphCount{std::move(other.m_wrappedParagraphCount)},
+            m_metrics              {nullptr},
+            m_relayoutQueued       {false},
+            m_relayoutJob          {0}
+        {
+            other.cancelRelayout();
+            other.resetAfterMove();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WordWrapper::~WordWrapper()
+        {
+            cancelRelayout();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WordWrapper& WordWrapper::operator=(const WordWrapper& other)
+        {
+            if (this != &other)
+            {
+                cancelRelayout();
+
+                m_text                  = other.m_text;
+                m_font                  = other.m_font;
+                m_textSize              = other.m_textSize;
+                m_bold                  = other.m_bold;
+                m_dropLeadingSpace      = other.m_dropLeadingSpace;
+                m_maxWidth              = other.m_maxWidth;
+                m_paragraphs            = other.m_paragraphs;
+                m_lines                 = other.m_lines;
+                m_linesNeedUpdate       = other.m_linesNeedUpdate;
+                m_wrappedParagraphCount = other.m_wrappedParagraphCount;
+                m_metrics               = nullptr;
+            }
+
+            return *this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WordWrapper& WordWrapper::operator=(WordWrapper&& other)
+        {
+            if (this != &other)
+            {
+                cancelRelayout();
+                other.cancelRelayout();
+
+                m_text                  = std::move(other.m_text);
+                m_font                  = std::move(other.m_font);
+                m_textSize              = std::move(other.m_textSize);
+                m_bold                  = std::move(other.m_bold);
+                m_dropLeadingSpace      = std::move(other.m_dropLeadingSpace);
+                m_maxWidth              = std::move(other.m_maxWidth);
+                m_paragraphs            = std::move(other.m_paragraphs);
+                m_lines                 = std::move(other.m_lines);
+                m_linesNeedUpdate       = std::move(other.m_linesNeedUpdate);
+                m_wrappedParagraphCount = std::move(other.m_wrappedParagraphCount);
+                m_metrics               = nullptr;
+
+                other.resetAfterMove();
+            }
+
+            return *this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::setFont(Font font, unsigned int textSize, bool bold)
+        {
+            if ((m_font == font) && (m_textSize == textSize) && (m_bold == bold))
+                return;
+
+            m_font = font;
+            m_textSize = textSize;
+            m_bold = bold;
+            m_metrics = nullptr;
+
+            for (auto& paragraph : m_paragraphs)
+                paragraph.wrapped = false;
+
+            m_linesNeedUpdate = true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::setDropLeadingSpace(bool dropLeadingSpace)
+        {
+            if (m_dropLeadingSpace == dropLeadingSpace)
+                return;
+
+            m_dropLeadingSpace = dropLeadingSpace;
+
+            for (auto& paragraph : m_paragraphs)
+                paragraph.wrapped = false;
+
+            m_linesNeedUpdate = true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::setText(const sf::String& text)
+        {
+            if (text == m_text)
+                return;
+
+            const std::size_t oldSize = m_text.getSize();
+            const std::size_t newSize = text.getSize();
+            const std::size_t minSize = std::min(oldSize, newSize);
+
+            // Find which part of the text was changed
+            std::size_t unchangedPrefix = 0;
+            while ((unchangedPrefix < minSize) && (m_text[unchangedPrefix] == text[unchangedPrefix]))
+                ++unchangedPrefix;
+
+            std::size_t unchangedSuffix = 0;
+            while ((unchangedSuffix < minSize - unchangedPrefix) && (m_text[oldSize - unchangedSuffix - 1] == text[newSize - unchangedSuffix - 1]))
+                ++unchangedSuffix;
+
+            m_text = text;
+            updateParagraphs(unchangedPrefix, unchangedSuffix);
+            m_linesNeedUpdate = true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const sf::String& WordWrapper::getText() const
+        {
+            return m_text;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::setMaximumWidth(float maxWidth)
+        {
+            if (m_maxWidth == maxWidth)
+                return;
+
+            m_maxWidth = maxWidth;
+            m_linesNeedUpdate = true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::vector<WordWrapper::Line>& WordWrapper::getLines()
+        {
+            m_wrappedParagraphCount = 0;
+            if (!m_linesNeedUpdate)
+                return m_lines;
+
+            const float maxWidth = (m_maxWidth != 0) ? m_maxWidth : std::numeric_limits<float>::infinity();
+
+            // The metrics are looked up once for all paragraphs
+            GlyphMetrics* const metrics = getMetrics();
+
+            m_lines.clear();
+            for (auto& paragraph : m_paragraphs)
+            {
+                // A paragraph that was wrapped without being split stays the same for every larger width, including an unbounded one
+                const bool linesValid = (maxWidth >= paragraph.minWidth)
+                                     && ((maxWidth < paragraph.maxWidth) || (paragraph.maxWidth == std::numeric_limits<float>::infinity()));
+                if (!paragraph.wrapped || !linesValid)
+                {
+                    wrapParagraph(paragraph, metrics);
+                    ++m_wrappedParagraphCount;
+                }
+
+                m_lines.insert(m_lines.end(), paragraph.lines.begin(), paragraph.lines.end());
+            }
+
+            m_linesNeedUpdate = false;
+            return m_lines;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::preloadGlyphs()
+        {
+            if (!m_linesNeedUpdate || (m_font == nullptr))
+                return;
+
+            getMetrics()->preload(m_text.getData(), m_text.getSize());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t WordWrapper::getWrappedParagraphCount() const
+        {
+            return m_wrappedParagraphCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::updateParagraphs(std::size_t unchangedPrefix, std::size_t unchangedSuffix)
+        {
+            std::vector<Paragraph> oldParagraphs;
+            oldParagraphs.swap(m_paragraphs);
+
+            const std::size_t newSize = m_text.getSize();
+            const sf::Uint32* const characters = m_text.getData();
+
+            std::size_t begin = 0;
+            while (true)
+            {
+                std::size_t end = begin;
+                while ((end < newSize) && (characters[end] != '\n'))
+                    ++end;
+
+                m_paragraphs.emplace_back();
+                m_paragraphs.back().begin = begin;
+                m_paragraphs.back().end = end;
+
+                if (end == newSize)
+                    break;
+
+                begin = end + 1;
+            }
+
+            // A paragraph keeps its lines when its contents and the newlines around it weren't changed
+            const std::size_t suffixStart = newSize - unchangedSuffix;
+            for (std::size_t i = 0; i < m_paragraphs.size(); ++i)
+            {
+                Paragraph& paragraph = m_paragraphs[i];
+                if (paragraph.end < unchangedPrefix)
+                {
+                    assert(i < oldParagraphs.size());
+                    paragraph = std::move(oldParagraphs[i]);
+                }
+                else if ((paragraph.begin > suffixStart) && (m_paragraphs.size() - i <= oldParagraphs.size()))
+                {
+                    Paragraph& oldParagraph = oldParagraphs[oldParagraphs.size() - (m_paragraphs.size() - i)];
+                    assert(oldParagraph.end - oldParagraph.begin == paragraph.end - paragraph.begin);
+
+                    for (auto& line : oldParagraph.lines)
+                    {
+                        line.begin = line.begin - oldParagraph.begin + paragraph.begin;
+                        line.end = line.end - oldParagraph.begin + paragraph.begin;
+                    }
+
+                    const std::size_t paragraphBegin = paragraph.begin;
+                    const std::size_t paragraphEnd = paragraph.end;
+                    paragraph = std::move(oldParagraph);
+                    paragraph.begin = paragraphBegin;
+                    paragraph.end = paragraphEnd;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphMetrics* WordWrapper::getMetrics()
+        {
+            // The metrics are kept until the font changes. They are also looked up again after the rendering mode changed,
+            // as text drawn from distance fields has different metrics.
+            if (!m_metrics || (m_metricsDistanceField != DistanceFieldFont::isEnabled()))
+            {
+                if (m_font == nullptr)
+                    return nullptr;
+
+                m_metrics = &GlyphMetrics::get(m_font.getFont(), m_textSize, m_bold);
+                m_metricsDistanceField = DistanceFieldFont::isEnabled();
+            }
+
+            return m_metrics;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::wrapParagraph(Paragraph& paragraph, GlyphMetrics* metrics) const
+        {
+            paragraph.lines.clear();
+            paragraph.minWidth = 0;
+            paragraph.maxWidth = std::numeric_limits<float>::infinity();
+            paragraph.wrapped = true;
+
+            if (!metrics)
+            {
+                paragraph.lines.push_back({paragraph.begin, paragraph.end});
+                return;
+            }
+            const float maxWidth = (m_maxWidth != 0) ? m_maxWidth : std::numeric_limits<float>::infinity();
+            const sf::Uint32* const text = m_text.getData();
+            const std::size_t textSize = m_text.getSize();
+
+            std::size_t index = paragraph.begin;
+            while (true)
+            {
+                const std::size_t lineBegin = index;
+
+                // Find out how many characters we can get on this line
+                float width = 0;
+                sf::Uint32 prevChar = 0;
+                while (index < paragraph.end)
+                {
+                    const sf::Uint32 curChar = text[index];
+                    const float charWidth = metrics->getAdvance(curChar);
+                    const float kerning = metrics->getKerning(prevChar, curChar);
+                    if (width + charWidth + kerning > maxWidth)
+                    {
+                        // The line would become longer if the maximum width was at least this large
+                        paragraph.maxWidth = std::min(paragraph.maxWidth, width + charWidth + kerning);
+                        break;
+                    }
+
+                    width += kerning + charWidth;
+                    paragraph.minWidth = std::max(paragraph.minWidth, width);
+                    prevChar = curChar;
+                    ++index;
+                }
+
+                // The rest of the paragraph fits on the line
+                if (index == paragraph.end)
+                {
+                    paragraph.lines.push_back({lineBegin, index});
+                    return;
+                }
+
+                // Every line contains at least one character
+                if (index == lineBegin)
+                    ++index;
+
+                // Implement the word-wrap by removing the last few characters from the line
+                if ((index < textSize) && !isWhitespace(text[index]))
+                {
+                    const std::size_t indexWithoutWordWrap = index;
+                    std::size_t wordWrapCorrection = 0;
+                    while ((index > lineBegin) && !isWhitespace(text[index - 1]))
+                    {
+                        wordWrapCorrection++;
+                        index--;
+                    }
+
+                    // The word can't be split but there is no other choice, it does not fit on the line
+                    if ((index - lineBegin) <= wordWrapCorrection)
+                        index = indexWithoutWordWrap;
+                }
+
+                // If the next line starts with just a space, then the space need not be visible
+                if (m_dropLeadingSpace && (index < textSize) && (text[index] == ' '))
+                {
+                    if ((index == 0) || !isWhitespace(text[index - 1]))
+                    {
+                        // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
+                        if (((index + 1 < textSize) && !isWhitespace(text[index + 1])) || (index + 1 == textSize))
+                            index++;
+                    }
+                }
+
+                paragraph.lines.push_back({lineBegin, index});
+
+                // When the wrapped line ended right in front of the newline, the newline still starts another (empty) line
+                if (index == paragraph.end)
+                {
+                    if (paragraph.end < textSize)
+                        paragraph.lines.push_back({paragraph.end, paragraph.end});
+
+                    return;
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::cancelRelayout()
+        {
+            if (m_relayoutQueued)
+            {
+                TextRelayoutPass::cancel(*this);
+                m_relayoutQueued = false;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WordWrapper::resetAfterMove()
+        {
+            m_text.clear();
+            m_paragraphs.assign(1, Paragraph{});
+            m_lines.clear();
+            m_linesNeedUpdate = true;
+            m_wrappedParagraphCount = 0;
+            m_metrics = nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,196 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/WorkerPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            // Waking the threads isn't free, small jobs are done on the calling thread
+            const std::size_t minWorkSizeForThreads = 4096;
+
+            // Threads that are started the first time they are needed and then wait for the next parallelFor call
+            class Workers
+            {
+            public:
+                ~Workers()
+                {
+                    stop();
+                }
+
+                // Calls the function for every index on the workers and the calling thread, returns when all calls are finished
+                void run(std::size_t workerCount, std::size_t count, const std::function<void(std::size_t)>& function)
+                {
+                    if (m_threads.size() != workerCount)
+                    {
+                        stop();
+                        start(workerCount);
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock{m_mutex};
+                        m_function = &function;
+                        m_count = count;
+                        m_nextIndex = 0;
+                        m_busyWorkers = m_threads.size();
+                        ++m_generation;
+                    }
+
+                    m_workAvailable.notify_all();
+                    work();
+
+                    std::unique_lock<std::mutex> lock{m_mutex};
+                    m_workFinished.wait(lock, [this]{ return m_busyWorkers == 0; });
+                    m_function = nullptr;
+                }
+
+                // Joins the threads, they are started again when the pool is used the next time
+                void stop()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock{m_mutex};
+                        m_stopping = true;
+                    }
+
+                    m_workAvailable.notify_all();
+                    for (auto& thread : m_threads)
+                        thread.join();
+
+                    m_threads.clear();
+                    m_stopping = false;
+                }
+
+            private:
+                void start(std::size_t workerCount)
+                {
+                    // The generation is passed to the workers, as they may only start waiting after the first job was handed out
+                    m_threads.reserve(workerCount);
+                    for (std::size_t i = 0; i < workerCount; ++i)
+                        m_threads.emplace_back(&Workers::workerLoop, this, m_generation);
+                }
+
+                void workerLoop(std::size_t generation)
+                {
+                    std::unique_lock<std::mutex> lock{m_mutex};
+                    while (true)
+                    {
+                        m_workAvailable.wait(lock, [&]{ return m_stopping || (m_generation != generation); });
+                        if (m_stopping)
+                            return;
+
+                        generation = m_generation;
+                        lock.unlock();
+                        work();
+                        lock.lock();
+
+                        if (--m_busyWorkers == 0)
+                            m_workFinished.notify_one();
+                    }
+                }
+
+                // Every thread keeps taking the next index until all of them are handled
+                void work()
+                {
+                    for (std::size_t i = m_nextIndex++; i < m_count; i = m_nextIndex++)
+                        (*m_function)(i);
+                }
+
+            private:
+                std::vector<std::thread> m_threads;
+                std::mutex m_mutex;
+                std::condition_variable m_workAvailable;
+                std::condition_variable m_workFinished;
+                const std::function<void(std::size_t)>* m_function = nullptr;
+                std::size_t m_count = 0;
+                std::atomic<std::size_t> m_nextIndex{0};
+                std::size_t m_busyWorkers = 0;
+                std::size_t m_generation = 0;
+                bool m_stopping = false;
+            };
+
+            Workers workers;
+            unsigned int requestedThreadCount = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WorkerPool::setThreadCount(unsigned int threadCount)
+        {
+            requestedThreadCount = threadCount;
+
+            // The workers are started again with the new amount when they are needed
+            workers.stop();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int WorkerPool::getThreadCount()
+        {
+            if (requestedThreadCount > 0)
+                return requestedThreadCount;
+
+            // The amount of cores isn't always known
+            return std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool WorkerPool::isWorthUsingThreads(std::size_t count, std::size_t workSize)
+        {
+            return (getThreadCount() > 1) && (count > 1) && (workSize >= minWorkSizeForThreads);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WorkerPool::parallelFor(std::size_t count, std::size_t workSize, const std::function<void(std::size_t)>& function)
+        {
+            if (!isWorthUsingThreads(count, workSize))
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    function(i);
+
+                return;
+            }
+
+            workers.run(getThreadCount() - 1, count, function);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
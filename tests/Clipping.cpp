@@ -53,3 +53,34 @@ TEST_CASE("[Clipping]")
 
     TEST_DRAW("Clipping.png")
 }
+
+TEST_CASE("[Clipping] Empty area")
+{
+    sf::RenderTexture target;
+    target.create(50, 50);
+    target.setActive(true);
+
+    {
+        const tgui::Clipping clipping{target, {}, {10, 10}, {20, 20}};
+        REQUIRE(!clipping.isEmpty());
+
+        const tgui::Clipping innerClipping{target, {}, {40, 40}, {5, 5}};
+        REQUIRE(innerClipping.isEmpty());
+    }
+
+    // Outside the gui there is no clipping stack for the target
+    REQUIRE(!tgui::Clipping::isCurrentAreaEmpty(target));
+
+    tgui::priv::ClippingStack stack;
+    tgui::Clipping::beginStack(stack, target, {0, 0, 50, 50});
+    REQUIRE(!tgui::Clipping::isCurrentAreaEmpty(target));
+    {
+        const tgui::Clipping clipping{target, {}, {60, 0}, {20, 20}};
+        REQUIRE(clipping.isEmpty());
+        REQUIRE(tgui::Clipping::isCurrentAreaEmpty(target));
+        REQUIRE(stack.areas.size() == 2);
+    }
+    REQUIRE(stack.areas.size() == 1);
+    REQUIRE(!tgui::Clipping::isCurrentAreaEmpty(target));
+    tgui::Clipping::endStack(stack);
+}
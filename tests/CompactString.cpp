@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/CompactString.hpp>
+
+TEST_CASE("[CompactString]")
+{
+    SECTION("Empty")
+    {
+        tgui::priv::CompactString str;
+        REQUIRE(str.isEmpty());
+        REQUIRE(str.getSize() == 0);
+        REQUIRE(str.toString() == "");
+        REQUIRE(str == "");
+    }
+
+    SECTION("ASCII")
+    {
+        tgui::priv::CompactString str{"Item 1"};
+        REQUIRE(!str.isEmpty());
+        REQUIRE(str.getSize() == 6);
+        REQUIRE(str.getUtf8() == "Item 1");
+        REQUIRE(str.toString() == "Item 1");
+        REQUIRE(str == "Item 1");
+        REQUIRE(str != "Item 2");
+        REQUIRE(str != "Item");
+        REQUIRE(str.startsWith("Item"));
+        REQUIRE(!str.startsWith("Item 12"));
+    }
+
+    SECTION("Unicode")
+    {
+        const sf::String original{L"é€ \U0001F600"};
+        tgui::priv::CompactString str{original};
+        REQUIRE(str.getSize() == original.getSize());
+        REQUIRE(str.getUtf8().size() == 2 + 3 + 1 + 4);
+        REQUIRE(str.toString() == original);
+        REQUIRE(str == original);
+        REQUIRE(original == str);
+        REQUIRE(str == tgui::priv::CompactString{original});
+    }
+
+    SECTION("Memory usage")
+    {
+        tgui::priv::CompactString str{"Some text that is too long to fit inside the object"};
+        REQUIRE(str.getMemoryUsage() > sizeof(tgui::priv::CompactString));
+        REQUIRE(str.getMemoryUsage() < sizeof(sf::String) + 4 * str.getSize());
+    }
+}
@@ -25,6 +25,8 @@
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
 
+#include <algorithm>
+
 TEST_CASE("[Container]")
 {
     auto container = std::make_shared<tgui::Gui>();
@@ -264,6 +266,116 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("render cache")
+    {
+        REQUIRE(!widget2->isRenderCacheEnabled());
+
+        widget2->setRenderCacheEnabled(true);
+        REQUIRE(widget2->isRenderCacheEnabled());
+
+        {
+            widget2->setSize({40, 40});
+            container->remove(widget2);
+
+            TEST_DRAW_INIT(50, 50, widget2)
+            gui.draw();
+            REQUIRE(widget2->isRenderCacheValid());
+
+            // Invalidating a child also invalidates the cache of its parent
+            widget4->invalidate();
+            REQUIRE(!widget2->isRenderCacheValid());
+        }
+
+        widget2->setRenderCacheEnabled(false);
+        REQUIRE(!widget2->isRenderCacheEnabled());
+
+        auto panel = tgui::Panel::create({100, 80});
+        panel->setPosition({10, 10});
+        panel->getRenderer()->setBackgroundColor(sf::Color::Blue);
+
+        auto child1 = tgui::Panel::create({40, 30});
+        child1->setPosition({10, 10});
+        child1->getRenderer()->setBackgroundColor(sf::Color::Red);
+        panel->add(child1);
+
+        auto child2 = tgui::Panel::create({30, 30});
+        child2->setPosition({50, 40});
+        child2->getRenderer()->setBackgroundColor(sf::Color::Yellow);
+        panel->add(child2);
+
+        // A child that clips its own contents, which has to happen inside the cache as well
+        auto child3 = tgui::ScrollablePanel::create({40, 25});
+        child3->setPosition({55, 5});
+        child3->getRenderer()->setBackgroundColor(sf::Color::Green);
+        panel->add(child3);
+
+        auto clippedWidget = tgui::Panel::create({60, 60});
+        clippedWidget->setPosition({5, 5});
+        clippedWidget->getRenderer()->setBackgroundColor(sf::Color::Magenta);
+        child3->add(clippedWidget);
+
+        TEST_DRAW_INIT(120, 100, panel)
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        const sf::Image uncachedImage = target.getTexture().copyToImage();
+
+        panel->setRenderCacheEnabled(true);
+        REQUIRE(!panel->isRenderCacheValid());
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        const sf::Image cachedImage = target.getTexture().copyToImage();
+        REQUIRE(panel->isRenderCacheValid());
+
+        // Drawing from the cache gives the same result as drawing the widgets directly
+        const std::size_t byteCount = 4 * uncachedImage.getSize().x * uncachedImage.getSize().y;
+        REQUIRE(cachedImage.getSize() == uncachedImage.getSize());
+        REQUIRE(std::equal(cachedImage.getPixelsPtr(), cachedImage.getPixelsPtr() + byteCount, uncachedImage.getPixelsPtr()));
+
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = 25;
+        event.mouseMove.y = 25;
+
+        // The child changes its hover state when the mouse enters it
+        gui.handleEvent(event);
+        REQUIRE(!panel->isRenderCacheValid());
+
+        gui.draw();
+        REQUIRE(panel->isRenderCacheValid());
+
+        // Moving the mouse on top of the same child doesn't change how anything looks
+        event.mouseMove.x = 30;
+        event.mouseMove.y = 35;
+        gui.handleEvent(event);
+        REQUIRE(panel->isRenderCacheValid());
+
+        // Leaving the child changes its hover state again
+        event.mouseMove.x = 115;
+        event.mouseMove.y = 95;
+        gui.handleEvent(event);
+        REQUIRE(!panel->isRenderCacheValid());
+
+        gui.draw();
+        REQUIRE(panel->isRenderCacheValid());
+
+        // Clicking next to the panel doesn't change any of its widgets
+        event.type = sf::Event::MouseButtonPressed;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = 115;
+        event.mouseButton.y = 95;
+        gui.handleEvent(event);
+        event.type = sf::Event::MouseButtonReleased;
+        gui.handleEvent(event);
+        REQUIRE(panel->isRenderCacheValid());
+
+        child2->invalidate();
+        REQUIRE(!panel->isRenderCacheValid());
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/Font.hpp>
+
+TEST_CASE("[DistanceFieldFont]")
+{
+    const std::shared_ptr<sf::Font> font = tgui::Font{"resources/DejaVuSans.ttf"}.getFont();
+    const unsigned int baseSize = tgui::priv::DistanceFieldFont::BaseCharacterSize;
+    const int spread = static_cast<int>(tgui::priv::DistanceFieldFont::Spread);
+
+    SECTION("Shared")
+    {
+        auto& fields = tgui::priv::DistanceFieldFont::get(font, false);
+        REQUIRE(&tgui::priv::DistanceFieldFont::get(font, false) == &fields);
+        REQUIRE(&tgui::priv::DistanceFieldFont::get(font, true) != &fields);
+    }
+
+    SECTION("Glyphs")
+    {
+        tgui::priv::DistanceFieldFont fields{*font, false};
+        REQUIRE(fields.getGlyphCount() == 0);
+
+        const auto& glyphA = fields.getGlyph('A');
+        const auto& glyphB = fields.getGlyph('B');
+        REQUIRE(fields.getGlyphCount() == 2);
+        REQUIRE(&fields.getGlyph('A') == &glyphA);
+
+        REQUIRE(glyphA.advance == font->getGlyph('A', baseSize, false).advance);
+        REQUIRE(glyphA.bounds == font->getGlyph('A', baseSize, false).bounds);
+        REQUIRE(glyphA.textureRect.width == font->getGlyph('A', baseSize, false).textureRect.width + 2 * spread);
+        REQUIRE(glyphA.textureRect.height == font->getGlyph('A', baseSize, false).textureRect.height + 2 * spread);
+        REQUIRE(fields.getKerning('A', 'V') == font->getKerning('A', 'V', baseSize));
+
+        // The glyphs don't overlap each other or the opaque pixels in the corner
+        REQUIRE(!glyphA.textureRect.intersects(glyphB.textureRect));
+        REQUIRE(!glyphA.textureRect.intersects({0, 0, 4, 4}));
+
+        // A space has no pixels, so it doesn't need a place in the atlas
+        REQUIRE(fields.getGlyph(' ').textureRect.width == 0);
+    }
+
+    SECTION("Scaled metrics")
+    {
+        tgui::Text::setDistanceFieldRendering(true);
+
+        // Shaders aren't necessarily available on the machine running the tests
+        if (tgui::Text::getDistanceFieldRendering())
+        {
+            auto& fields = tgui::priv::DistanceFieldFont::get(font, false);
+            auto& metrics = tgui::priv::GlyphMetrics::get(font, 24, false);
+            REQUIRE(metrics.getAdvance('A') == Approx(fields.getGlyph('A').advance / 2));
+            REQUIRE(metrics.getAdvance('\t') == Approx(fields.getGlyph(' ').advance * 2));
+            REQUIRE(metrics.getKerning('A', 'V') == Approx(fields.getKerning('A', 'V') / 2));
+            REQUIRE(metrics.getLineSpacing() == font->getLineSpacing(24));
+
+            tgui::Text text;
+            text.setFont(font);
+            text.setCharacterSize(24);
+            text.setString("AV\nA");
+            REQUIRE(text.findCharacterPos(2).x == Approx(metrics.getLineWidth(text.getString().getData(), 2)));
+            REQUIRE(text.findCharacterPos(3) == sf::Vector2f{0, metrics.getLineSpacing()});
+            REQUIRE(text.findCharacterPos(100) == text.findCharacterPos(4));
+        }
+
+        tgui::Text::setDistanceFieldRendering(false);
+        REQUIRE(!tgui::Text::getDistanceFieldRendering());
+    }
+}
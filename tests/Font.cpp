@@ -35,4 +35,27 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("Fonts loaded from the same file are shared")
+    {
+        tgui::Font font3("resources/DejaVuSans.ttf");
+        tgui::Font font4("resources/DejaVuSans.ttf");
+        REQUIRE(font3 == font4);
+    }
+
+    SECTION("preloadGlyphs")
+    {
+        tgui::Font font3(std::make_shared<sf::Font>());
+        font3.getFont()->loadFromFile("resources/DejaVuSans.ttf");
+
+        REQUIRE(font3.preloadGlyphs({}, {20}).requestedGlyphCount == 0);
+        REQUIRE(tgui::Font().preloadGlyphs({{'a', 'z'}}, {20}).requestedGlyphCount == 0);
+
+        const auto statistics = font3.preloadGlyphs({{' ', '~'}, {0xE9, 0xE9}}, {20, 40});
+        REQUIRE(statistics.requestedGlyphCount == 2 * (95 + 1));
+        REQUIRE(statistics.textureMemory > 0);
+
+        // The glyphs already exist when loading them again
+        REQUIRE(font3.preloadGlyphs({{' ', '~'}}, {40}).textureMemory == 0);
+    }
 }
@@ -0,0 +1,71 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/FontCache.hpp>
+
+TEST_CASE("[FontCache]")
+{
+    auto font1 = std::make_shared<sf::Font>();
+    auto font2 = std::make_shared<sf::Font>();
+
+    SECTION("Values per font")
+    {
+        tgui::priv::FontCache<const sf::Font*, int> cache;
+        REQUIRE(cache.find(font1.get(), font1) == nullptr);
+
+        cache.insert(font1.get(), font1, 1);
+        cache.get(font2.get(), font2) = 2;
+        REQUIRE(cache.getSize() == 2);
+        REQUIRE(*cache.find(font1.get(), font1) == 1);
+        REQUIRE(cache.get(font2.get(), font2) == 2);
+
+        // A different font with the same key doesn't get the value of the old font
+        REQUIRE(cache.find(font1.get(), font2) == nullptr);
+        REQUIRE(cache.getSize() == 1);
+
+        cache.clear();
+        REQUIRE(cache.getSize() == 0);
+    }
+
+    SECTION("Destroyed fonts")
+    {
+        tgui::priv::FontCache<std::string> cache;
+        cache.insert("font1", font1);
+        cache.insert("font2", font2);
+        REQUIRE(cache.findFont("font1") == font1);
+        REQUIRE(cache.findFont("font3") == nullptr);
+
+        font1 = nullptr;
+        REQUIRE(cache.findFont("font1") == nullptr);
+        REQUIRE(cache.getSize() == 2);
+
+        // The values of destroyed fonts are removed when a new value is stored
+        cache.insert("font3", font2);
+        REQUIRE(cache.getSize() == 2);
+        REQUIRE(cache.findFont("font2") == font2);
+        REQUIRE(cache.findFont("font3") == font2);
+    }
+}
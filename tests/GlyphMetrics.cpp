@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/Font.hpp>
+
+TEST_CASE("[GlyphMetrics]")
+{
+    const std::shared_ptr<sf::Font> font = tgui::Font{"resources/DejaVuSans.ttf"}.getFont();
+
+    SECTION("Shared")
+    {
+        auto& metrics = tgui::priv::GlyphMetrics::get(font, 20, false);
+        REQUIRE(&tgui::priv::GlyphMetrics::get(font, 20, false) == &metrics);
+        REQUIRE(&tgui::priv::GlyphMetrics::get(font, 20, true) != &metrics);
+        REQUIRE(&tgui::priv::GlyphMetrics::get(font, 30, false) != &metrics);
+    }
+
+    SECTION("Same values as font")
+    {
+        auto& metrics = tgui::priv::GlyphMetrics::get(font, 20, true);
+        REQUIRE(metrics.getAdvance('A') == font->getGlyph('A', 20, true).advance);
+        REQUIRE(metrics.getAdvance(0x20AC) == font->getGlyph(0x20AC, 20, true).advance);
+        REQUIRE(metrics.getAdvance('\t') == 4 * font->getGlyph(' ', 20, true).advance);
+        REQUIRE(metrics.getKerning('A', 'V') == font->getKerning('A', 'V', 20));
+        REQUIRE(metrics.getKerning('A', 0x20AC) == font->getKerning('A', 0x20AC, 20));
+        REQUIRE(metrics.getLineSpacing() == font->getLineSpacing(20));
+    }
+
+    SECTION("Line width")
+    {
+        auto& metrics = tgui::priv::GlyphMetrics::get(font, 20, false);
+
+        const sf::String text = L"AVA€";
+        float width = 0;
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < text.getSize(); ++i)
+        {
+            width += font->getKerning(prevChar, text[i], 20) + font->getGlyph(text[i], 20, false).advance;
+            prevChar = text[i];
+        }
+
+        REQUIRE(metrics.getLineWidth(text.getData(), text.getSize()) == Approx(width));
+
+        // Text that only contains ASCII characters is summed from the tables, which are filled by getLineWidth itself
+        auto& asciiMetrics = tgui::priv::GlyphMetrics::get(font, 17, false);
+        const sf::String asciiText = "To AVoid\tkerning";
+        float asciiWidth = 0;
+        prevChar = 'W';
+        for (std::size_t i = 0; i < asciiText.getSize(); ++i)
+        {
+            const float advance = (asciiText[i] == '\t') ? 4 * font->getGlyph(' ', 17, false).advance : font->getGlyph(asciiText[i], 17, false).advance;
+            asciiWidth += font->getKerning(prevChar, asciiText[i], 17) + advance;
+            prevChar = asciiText[i];
+        }
+
+        REQUIRE(asciiMetrics.getLineWidth(asciiText.getData(), asciiText.getSize(), 'W') == Approx(asciiWidth));
+        REQUIRE(asciiMetrics.getLineWidth(asciiText.getData(), asciiText.getSize(), 'W') == Approx(asciiWidth));
+    }
+}
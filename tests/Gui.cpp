@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Animation.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <limits>
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(200, 200);
+    tgui::Gui gui{target};
+
+    SECTION("needsRedraw")
+    {
+        auto panel = tgui::Panel::create({100, 100});
+        auto button = tgui::Button::create();
+        button->setPosition({10, 10});
+        button->setSize({50, 30});
+        panel->add(button);
+        gui.add(panel);
+
+        unsigned int invalidatedCount = 0;
+        gui.onInvalidated.connect([&]{ invalidatedCount++; });
+
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        // Changing a widget inside a container requires the gui to be redrawn
+        button->setText("Hello");
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(invalidatedCount == 1);
+
+        // The signal is only emitted once until the gui is drawn again
+        button->setTextSize(20);
+        REQUIRE(invalidatedCount == 1);
+
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        SECTION("Hover")
+        {
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+
+            // Moving the mouse over an empty part of the gui changes nothing
+            event.mouseMove.x = 150;
+            event.mouseMove.y = 150;
+            gui.handleEvent(event);
+            REQUIRE(!gui.needsRedraw());
+
+            // The button changes color when the mouse enters it
+            event.mouseMove.x = 20;
+            event.mouseMove.y = 20;
+            gui.handleEvent(event);
+            REQUIRE(gui.needsRedraw());
+            REQUIRE(invalidatedCount == 2);
+
+            gui.draw();
+
+            // Moving on top of the button doesn't change it
+            event.mouseMove.x = 25;
+            gui.handleEvent(event);
+            REQUIRE(!gui.needsRedraw());
+
+            // Leaving the button does change it
+            event.mouseMove.x = 150;
+            gui.handleEvent(event);
+            REQUIRE(gui.needsRedraw());
+            REQUIRE(invalidatedCount == 3);
+        }
+
+        SECTION("Removing widget")
+        {
+            panel->remove(button);
+            REQUIRE(gui.needsRedraw());
+
+            // Widgets that are no longer part of the gui don't affect it
+            gui.draw();
+            button->setText("World");
+            REQUIRE(!gui.needsRedraw());
+        }
+
+        SECTION("Manual invalidation")
+        {
+            gui.invalidate();
+            REQUIRE(gui.needsRedraw());
+        }
+
+        SECTION("Unchanged widgets")
+        {
+            // Setting properties to the values they already have changes nothing
+            button->setTextSize(20);
+            button->show();
+            button->enable();
+            REQUIRE(!gui.needsRedraw());
+
+            auto listBox = tgui::ListBox::create();
+            listBox->setMaximumItems(1);
+            listBox->addItem("1");
+            panel->add(listBox);
+            gui.draw();
+
+            // An item that is rejected by the limit doesn't change the list box
+            REQUIRE(!listBox->addItem("2"));
+            REQUIRE(!gui.needsRedraw());
+        }
+
+        SECTION("Hidden widgets")
+        {
+            button->hide();
+            REQUIRE(gui.needsRedraw());
+
+            // Changing a widget that isn't shown doesn't require the gui to be redrawn
+            gui.draw();
+            button->setText("World");
+            REQUIRE(!gui.needsRedraw());
+
+            button->show();
+            REQUIRE(gui.needsRedraw());
+        }
+    }
+
+    SECTION("Culling")
+    {
+        auto panel = tgui::Panel::create({100, 100});
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            auto button = tgui::Button::create();
+            button->setPosition({0, i * 40.f});
+            button->setSize({50, 30});
+            panel->add(button);
+        }
+        gui.add(panel);
+
+        // Only the first 3 buttons lie inside the panel
+        gui.draw();
+        REQUIRE(gui.getCulledWidgetCount() == 7);
+
+        // Widgets outside the window aren't drawn either
+        panel->setPosition({300, 0});
+        gui.draw();
+        REQUIRE(gui.getCulledWidgetCount() == 1);
+    }
+
+    SECTION("getTimeUntilNextUpdate")
+    {
+        const sf::Time noUpdate = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+        REQUIRE(gui.getTimeUntilNextUpdate() == noUpdate);
+
+        auto editBox = tgui::EditBox::create();
+        gui.add(editBox);
+        REQUIRE(gui.getTimeUntilNextUpdate() == noUpdate);
+
+        // The caret of a focused edit box blinks
+        editBox->focus();
+        REQUIRE(gui.getTimeUntilNextUpdate() > sf::Time::Zero);
+        REQUIRE(gui.getTimeUntilNextUpdate() <= sf::milliseconds(500));
+
+        // Hidden widgets aren't updated
+        editBox->hide();
+        REQUIRE(gui.getTimeUntilNextUpdate() == noUpdate);
+
+        // Animations require an update every frame
+        editBox->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        REQUIRE(gui.getTimeUntilNextUpdate() == sf::Time::Zero);
+    }
+}
@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/IndexedItemList.hpp>
+
+TEST_CASE("[IndexedItemList]")
+{
+    tgui::priv::IndexedItemList list;
+    list.add("Item 1", "1", 20);
+    list.add("Item 2", "", 20);
+    list.add("Item 3", "3", 20);
+    list.add("Item 2", "4", 20);
+    REQUIRE(list.getSize() == 4);
+
+    SECTION("Find")
+    {
+        REQUIRE(list.findText("Item 1") == 0);
+        REQUIRE(list.findText("Item 2") == 1);
+        REQUIRE(list.findText("Item 4") == tgui::priv::IndexedItemList::NotFound);
+        REQUIRE(list.findId("3") == 2);
+        REQUIRE(list.findId("") == 1);
+        REQUIRE(list.findId("2") == tgui::priv::IndexedItemList::NotFound);
+
+        list.add("Item 5", "5", 20);
+        REQUIRE(list.findText("Item 5") == 4);
+        REQUIRE(list.findId("5") == 4);
+    }
+
+    SECTION("Remove")
+    {
+        list.findText("Item 1");
+
+        list.remove(1);
+        REQUIRE(list.getSize() == 3);
+        REQUIRE(list[1].text == "Item 3");
+        REQUIRE(list.findText("Item 2") == 2);
+        REQUIRE(list.findId("3") == 1);
+        REQUIRE(list.findId("") == tgui::priv::IndexedItemList::NotFound);
+
+        list.add("Item 6", "6", 20);
+        REQUIRE(list.findId("6") == 3);
+
+        list.remove(0);
+        list.remove(0);
+        REQUIRE(list.getSize() == 2);
+        REQUIRE(list[0].text == "Item 2");
+        REQUIRE(list[1].text == "Item 6");
+        REQUIRE(list.findText("Item 1") == tgui::priv::IndexedItemList::NotFound);
+        REQUIRE(list.findId("6") == 1);
+    }
+
+    SECTION("Change text")
+    {
+        list.findText("Item 1");
+
+        list.setText(1, "Item 7");
+        REQUIRE(list.findText("Item 2") == 3);
+        REQUIRE(list.findText("Item 7") == 1);
+        REQUIRE(list[1].id == "");
+    }
+
+    SECTION("Find texts containing")
+    {
+        REQUIRE(list.findTextsContaining("Item 2") == std::vector<std::size_t>{1, 3});
+        REQUIRE(list.findTextsContaining("tem") == std::vector<std::size_t>{0, 1, 2, 3});
+        REQUIRE(list.findTextsContaining("3") == std::vector<std::size_t>{2});
+        REQUIRE(list.findTextsContaining("") == std::vector<std::size_t>{0, 1, 2, 3});
+        REQUIRE(list.findTextsContaining("item").empty());
+        REQUIRE(list.findTextsContaining("m 1 ").empty());
+
+        list.remove(1);
+        list.setText(0, "Item 22");
+        list.add("Other", "", 20);
+        REQUIRE(list.findTextsContaining("Item 2") == std::vector<std::size_t>{0, 2});
+        REQUIRE(list.findTextsContaining("the") == std::vector<std::size_t>{3});
+    }
+
+    SECTION("Heights")
+    {
+        list.setHeight(1, 50);
+        REQUIRE(list.getHeight(1) == 50);
+        REQUIRE(list.getTop(0) == 0);
+        REQUIRE(list.getTop(2) == 70);
+        REQUIRE(list.getTotalHeight() == 110);
+        REQUIRE(list.findIndexAtOffset(19) == 0);
+        REQUIRE(list.findIndexAtOffset(20) == 1);
+        REQUIRE(list.findIndexAtOffset(69) == 1);
+        REQUIRE(list.findIndexAtOffset(70) == 2);
+        REQUIRE(list.findIndexAtOffset(110) == 4);
+
+        list.remove(1);
+        REQUIRE(list.getTotalHeight() == 60);
+        REQUIRE(list.getTop(2) == 40);
+        REQUIRE(list.findIndexAtOffset(20) == 1);
+
+        list.setAllHeights(10);
+        REQUIRE(list.getTotalHeight() == 30);
+        REQUIRE(list.findIndexAtOffset(25) == 2);
+    }
+
+    SECTION("Truncate")
+    {
+        list.remove(0);
+        list.truncate(2);
+        REQUIRE(list.getSize() == 2);
+        REQUIRE(list[1].text == "Item 3");
+        REQUIRE(list.findId("4") == tgui::priv::IndexedItemList::NotFound);
+
+        list.clear();
+        REQUIRE(list.getSize() == 0);
+        REQUIRE(list.findText("Item 2") == tgui::priv::IndexedItemList::NotFound);
+    }
+
+    SECTION("Many items")
+    {
+        list.clear();
+        for (unsigned int i = 0; i < 10000; ++i)
+            list.add("Item " + tgui::to_string(i), tgui::to_string(i), 20);
+
+        for (unsigned int i = 0; i < 10000; i += 2)
+            list.remove(i / 2);
+
+        REQUIRE(list.getSize() == 5000);
+        REQUIRE(list[0].text == "Item 1");
+        REQUIRE(list[4999].text == "Item 9999");
+        REQUIRE(list.findId("5001") == 2500);
+        REQUIRE(list.findId("5000") == tgui::priv::IndexedItemList::NotFound);
+        REQUIRE(list.getTotalHeight() == 5000 * 20);
+        REQUIRE(list.findIndexAtOffset(2500 * 20 + 5) == 2500);
+    }
+}
@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/ItemView.hpp>
+#include <algorithm>
+
+namespace
+{
+    std::vector<sf::String> getShownItems(const tgui::priv::ItemView& view, const tgui::priv::IndexedItemList& list)
+    {
+        std::vector<sf::String> items;
+        for (std::size_t row = 0; row < view.getRowCount(list); ++row)
+            items.push_back(list[view.getItemIndex(row, list)].text.toString());
+
+        return items;
+    }
+
+    void addItem(tgui::priv::ItemView& view, tgui::priv::IndexedItemList& list, const sf::String& text, unsigned int height = 10)
+    {
+        list.add(text, "", height);
+        view.itemAdded(list);
+    }
+}
+
+TEST_CASE("[ItemView]")
+{
+    tgui::priv::IndexedItemList list;
+    tgui::priv::ItemView view;
+    addItem(view, list, "Banana");
+    addItem(view, list, "Cherry");
+    addItem(view, list, "Apple", 20);
+
+    REQUIRE(!view.isActive());
+    REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Banana", "Cherry", "Apple"});
+
+    SECTION("Sorting")
+    {
+        view.setComparator([](const sf::String& left, const sf::String& right){ return left < right; }, list);
+        REQUIRE(view.isActive());
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Apple", "Banana", "Cherry"});
+        REQUIRE(view.getItemIndex(0, list) == 2);
+        REQUIRE(view.findRow(0, list) == 1);
+        REQUIRE(view.getRowTop(1, list) == 20);
+        REQUIRE(view.findRowAtOffset(25, list) == 1);
+        REQUIRE(view.getTotalHeight(list) == 40);
+
+        addItem(view, list, "Blueberry");
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Apple", "Banana", "Blueberry", "Cherry"});
+
+        list.setText(1, "Avocado");
+        view.itemTextChanged(1, list);
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Apple", "Avocado", "Banana", "Blueberry"});
+
+        view.itemRemoved(0, list);
+        list.remove(0);
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Apple", "Avocado", "Blueberry"});
+        REQUIRE(view.getItemIndex(0, list) == 1);
+
+        view.setComparator(nullptr, list);
+        REQUIRE(!view.isActive());
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Avocado", "Apple", "Blueberry"});
+    }
+
+    SECTION("Sorting many items")
+    {
+        for (unsigned int i = 0; i < 20000; ++i)
+            addItem(view, list, "Item " + tgui::to_string((i * 7919) % 20000));
+
+        view.setComparator([](const sf::String& left, const sf::String& right){ return left > right; }, list);
+        const auto items = getShownItems(view, list);
+        REQUIRE(items.size() == 20003);
+        REQUIRE(std::is_sorted(items.begin(), items.end(), [](const sf::String& left, const sf::String& right){ return left > right; }));
+
+        for (unsigned int i = 0; i < 100; ++i)
+            addItem(view, list, "Item " + tgui::to_string(i));
+
+        const auto newItems = getShownItems(view, list);
+        REQUIRE(newItems.size() == 20103);
+        REQUIRE(std::is_sorted(newItems.begin(), newItems.end(), [](const sf::String& left, const sf::String& right){ return left > right; }));
+    }
+
+    SECTION("Removing many items")
+    {
+        for (unsigned int i = 0; i < 1000; ++i)
+            addItem(view, list, "Item " + tgui::to_string(i), 1 + (i % 3));
+
+        view.setComparator([](const sf::String& left, const sf::String& right){ return left > right; }, list);
+        view.setFilter("1", list);
+        const std::size_t shownCount = view.getRowCount(list);
+        const unsigned int shownHeight = view.getTotalHeight(list);
+
+        // Remove every item that doesn't contain a 1 (including the first three), the others keep their rows
+        for (std::size_t i = list.getSize(); i > 0; --i)
+        {
+            if (list[i-1].text.getUtf8().find('1') == std::string::npos)
+            {
+                view.itemRemoved(i-1, list);
+                list.remove(i-1);
+            }
+        }
+
+        REQUIRE(list.getSize() == shownCount);
+        REQUIRE(view.getRowCount(list) == shownCount);
+        REQUIRE(view.getTotalHeight(list) == shownHeight);
+
+        const auto items = getShownItems(view, list);
+        REQUIRE(std::is_sorted(items.begin(), items.end(), [](const sf::String& left, const sf::String& right){ return left > right; }));
+        for (std::size_t row = 0; row < items.size(); ++row)
+            REQUIRE(view.findRow(view.getItemIndex(row, list), list) == row);
+
+        // Changing the height of an item only changes the tops of the rows below it
+        const std::size_t index = view.getItemIndex(1, list);
+        const unsigned int oldHeight = list.getHeight(index);
+        list.setHeight(index, oldHeight + 10);
+        view.itemHeightChanged(index, oldHeight, list);
+        REQUIRE(view.getRowTop(1, list) == list.getHeight(view.getItemIndex(0, list)));
+        REQUIRE(view.getRowTop(2, list) == list.getHeight(view.getItemIndex(0, list)) + oldHeight + 10);
+        REQUIRE(view.getTotalHeight(list) == shownHeight + 10);
+    }
+
+    SECTION("Filtering text")
+    {
+        view.setFilter("an", list);
+        REQUIRE(view.isActive());
+        REQUIRE(view.getFilterText() == "an");
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Banana"});
+        REQUIRE(view.findRow(2, list) == tgui::priv::IndexedItemList::NotFound);
+        REQUIRE(view.getTotalHeight(list) == 10);
+
+        addItem(view, list, "Mango", 30);
+        addItem(view, list, "Kiwi");
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Banana", "Mango"});
+        REQUIRE(view.getTotalHeight(list) == 40);
+
+        list.setText(2, "Orange");
+        view.itemTextChanged(2, list);
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Banana", "Orange", "Mango"});
+        REQUIRE(view.getTotalHeight(list) == 60);
+
+        view.setFilter("ang", list);
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Orange", "Mango"});
+        REQUIRE(view.findRowAtOffset(20, list) == 1);
+
+        view.setFilter("", list);
+        REQUIRE(!view.isActive());
+        REQUIRE(getShownItems(view, list).size() == 5);
+    }
+
+    SECTION("Filtering with predicate")
+    {
+        view.setFilter([](const sf::String& item){ return item.getSize() == 6; }, list);
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Banana", "Cherry"});
+        REQUIRE(view.getFilterText() == "");
+
+        view.setFilter(tgui::priv::ItemView::Predicate{}, list);
+        REQUIRE(!view.isActive());
+    }
+
+    SECTION("Sorting and filtering")
+    {
+        view.setComparator([](const sf::String& left, const sf::String& right){ return left < right; }, list);
+        view.setFilter("e", list);
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Apple", "Cherry"});
+
+        list.setHeight(1, 50);
+        view.itemHeightChanged(1, 10, list);
+        REQUIRE(view.getTotalHeight(list) == 70);
+        REQUIRE(view.getRowTop(1, list) == 20);
+
+        list.truncate(1);
+        view.itemsTruncated(1, list);
+        REQUIRE(getShownItems(view, list).empty());
+        REQUIRE(view.getTotalHeight(list) == 0);
+
+        list.clear();
+        view.itemsCleared();
+        addItem(view, list, "Pear");
+        addItem(view, list, "Peach");
+        REQUIRE(getShownItems(view, list) == std::vector<sf::String>{"Peach", "Pear"});
+    }
+}
@@ -49,6 +49,19 @@ TEST_CASE("[Theme]")
             REQUIRE_THROWS_AS(theme.load("nonexistent_file"), tgui::Exception);
         }
 
+        SECTION("Glyphs section")
+        {
+            tgui::Theme theme;
+            REQUIRE(theme.getGlyphPreloadStatistics().requestedGlyphCount == 0);
+
+            theme.load("resources/ThemeGlyphs.txt");
+            REQUIRE(theme.getGlyphPreloadStatistics().requestedGlyphCount == 2 * (95 + 1));
+            REQUIRE(theme.getRenderer("Label")->propertyValuePairs["textcolor"].getColor() == sf::Color::Red);
+
+            theme.load("resources/ThemeButton1.txt");
+            REQUIRE(theme.getGlyphPreloadStatistics().requestedGlyphCount == 0);
+        }
+
         SECTION("nonexistent section")
         {
             // White theme is created on the fly as it uses default values
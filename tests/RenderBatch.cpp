@@ -0,0 +1,392 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+TEST_CASE("[RenderBatch]")
+{
+    sf::RenderTexture target;
+    target.create(50, 50);
+
+    const sf::Vertex vertices[] = {
+        {{0, 0}, sf::Color::Red},
+        {{0, 10}, sf::Color::Red},
+        {{10, 0}, sf::Color::Red},
+        {{10, 10}, sf::Color::Red}
+    };
+
+    SECTION("Active batch")
+    {
+        tgui::priv::RenderBatch batch;
+        REQUIRE(tgui::priv::RenderBatch::getActive(target) == nullptr);
+
+        batch.begin(target);
+        REQUIRE(tgui::priv::RenderBatch::getActive(target) == &batch);
+
+        sf::RenderTexture otherTarget;
+        REQUIRE(tgui::priv::RenderBatch::getActive(otherTarget) == nullptr);
+
+        batch.setPaused(true);
+        REQUIRE(tgui::priv::RenderBatch::getActive(target) == nullptr);
+        batch.setPaused(false);
+        REQUIRE(tgui::priv::RenderBatch::getActive(target) == &batch);
+
+        batch.end();
+        REQUIRE(tgui::priv::RenderBatch::getActive(target) == nullptr);
+    }
+
+    SECTION("Merging geometry")
+    {
+        tgui::priv::RenderBatch batch;
+        batch.begin(target);
+        batch.addTriangleStrip(vertices, 4, {});
+        batch.addTriangleStrip(vertices, 4, sf::Transform().translate(20, 20));
+        batch.addTriangleStrip(vertices, 4, sf::Transform().translate(30, 0));
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 1);
+
+        // A change of texture starts a new draw call
+        sf::Texture texture;
+        texture.create(10, 10);
+        batch.begin(target);
+        batch.addTriangleStrip(vertices, 4, {});
+        batch.addTriangleStrip(vertices, 4, &texture);
+        batch.addTriangleStrip(vertices, 4, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 3);
+
+        // Flushing draws the queued geometry
+        batch.begin(target);
+        batch.addTriangleStrip(vertices, 4, {});
+        tgui::priv::RenderBatch::flushActive(target);
+        batch.addTriangleStrip(vertices, 4, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 2);
+
+        // Nothing is drawn when nothing was added
+        batch.begin(target);
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 0);
+    }
+
+    SECTION("Primitives")
+    {
+        tgui::priv::RenderBatch batch;
+        batch.begin(target);
+        batch.addRectangle({10, 10}, sf::Color::Red, {});
+        batch.addBorders({1, 2, 3, 4}, {20, 20}, sf::Color::Blue, sf::Transform().translate(20, 20));
+        batch.addTriangleStrip(vertices, 4, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 1);
+
+        // Geometry with a blend mode is drawn directly
+        batch.begin(target);
+        batch.addRectangle({10, 10}, sf::Color::Red, {});
+        batch.addRectangle({10, 10}, sf::Color::Red, sf::BlendAdd);
+        batch.addBorders({1}, {20, 20}, sf::Color::Blue, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 3);
+    }
+
+    SECTION("Allocations")
+    {
+        tgui::priv::RenderBatch batch;
+
+        const auto drawFrame = [&]{
+            batch.begin(target);
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                batch.addRectangle({10, 10}, sf::Color::Red, sf::Transform().translate(static_cast<float>(i), 0));
+                batch.addBorders({2}, {10, 10}, sf::Color::Blue, sf::Transform().translate(static_cast<float>(i), 0));
+            }
+            batch.end();
+        };
+
+        drawFrame();
+        REQUIRE(batch.getAllocationCount() > 0);
+
+        // Drawing the same geometry again reuses the memory
+        drawFrame();
+        REQUIRE(batch.getAllocationCount() == 0);
+    }
+
+    SECTION("Nine-slice")
+    {
+        tgui::priv::RenderBatch batch;
+
+        tgui::Texture texture{"resources/image.png", {}, {10, 10, 30, 30}};
+        sf::RenderStates states;
+        states.texture = &texture.getData()->texture;
+
+        sf::RenderStates movedStates = states;
+        movedStates.transform.translate(5, 5);
+
+        const std::size_t version = tgui::priv::RenderBatch::createGeometryVersion();
+        const auto drawFrame = [&]{
+            batch.begin(target);
+            batch.addNineSlice({40, 40}, {0, 0, 50, 50}, {10, 10, 30, 30}, sf::Color::White, states, version);
+            batch.addNineSlice({40, 40}, {0, 0, 50, 50}, {10, 10, 30, 30}, sf::Color::White, movedStates, version);
+            batch.end();
+        };
+
+        drawFrame();
+        REQUIRE(batch.getDrawCallCount() == 1);
+
+        drawFrame();
+        REQUIRE(batch.getDrawCallCount() == 1);
+        REQUIRE(batch.getAllocationCount() == 0);
+    }
+
+    SECTION("Text")
+    {
+        tgui::Text text1;
+        text1.setFont("resources/DejaVuSans.ttf");
+        text1.setString("First line");
+
+        tgui::Text text2 = text1;
+        text2.setString("Second line");
+        text2.setPosition(0, 20);
+
+        tgui::Text text3 = text1;
+        text3.setCharacterSize(20);
+
+        tgui::priv::RenderBatch batch;
+        batch.begin(target);
+        text1.draw(target, {});
+        text2.draw(target, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 1);
+
+        // Texts of a different size use a different page of the font texture
+        batch.begin(target);
+        text1.draw(target, {});
+        text3.draw(target, {});
+        text2.draw(target, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 3);
+    }
+
+    SECTION("Uploads")
+    {
+        tgui::priv::RenderBatch batch;
+
+        const auto drawFrame = [&](float offset){
+            batch.begin(target);
+            for (unsigned int i = 0; i < 10; ++i)
+                batch.addRectangle({10, 10}, sf::Color::Red, sf::Transform().translate(offset + i, 0));
+            batch.end();
+        };
+
+        // With a vertex buffer, the first frame is drawn from memory and copied to the graphics card afterwards
+        drawFrame(0);
+        REQUIRE(batch.getUploadedVertexCount() >= 60);
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        if (sf::VertexBuffer::isAvailable())
+        {
+            // Identical frames don't need to send anything to the graphics card
+            drawFrame(0);
+            REQUIRE(batch.getUploadedVertexCount() == 0);
+
+            drawFrame(5);
+            REQUIRE(batch.getUploadedVertexCount() == 60);
+        }
+    #endif
+    }
+
+    SECTION("Uploads when an earlier owner changes its amount of vertices")
+    {
+        tgui::priv::RenderBatch batch;
+        const int owners[10] = {};
+
+        const auto drawFrame = [&](const tgui::Borders& firstBorders, bool extraRectangle){
+            batch.begin(target);
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                const tgui::priv::RenderBatch::OwnerScope ownerScope{&batch, &owners[i]};
+                const sf::Transform transform = sf::Transform().translate(i * 4.f, 0);
+                batch.addBorders((i == 0) ? firstBorders : tgui::Borders{1}, {4, 4}, sf::Color::Blue, transform);
+                if ((i == 0) && extraRectangle)
+                    batch.addRectangle({2, 2}, sf::Color::Red, transform);
+            }
+            batch.end();
+        };
+
+        drawFrame({1}, false);
+        REQUIRE(batch.getUploadedVertexCount() >= 240);
+        REQUIRE(batch.getDrawCallCount() == 1);
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        if (sf::VertexBuffer::isAvailable())
+        {
+            // Removing the top and bottom borders of the first owner only rewrites its own slot, in which those quads are
+            // replaced by degenerate triangles. The other owners keep their slots and aren't uploaded again.
+            drawFrame({1, 0, 1, 0}, false);
+            REQUIRE(batch.getUploadedVertexCount() == 24);
+            REQUIRE(batch.getDrawCallCount() == 1);
+
+            drawFrame({1}, false);
+            REQUIRE(batch.getUploadedVertexCount() == 24);
+            REQUIRE(batch.getDrawCallCount() == 1);
+
+            // An extra piece doesn't fit between the existing slots, it is placed behind them which splits the draw call
+            drawFrame({1}, true);
+            REQUIRE(batch.getDrawCallCount() == 3);
+
+            // The slots are placed in the drawing order again in the next frame, after which nothing changes anymore
+            drawFrame({1}, true);
+            REQUIRE(batch.getUploadedVertexCount() > 0);
+            REQUIRE(batch.getDrawCallCount() == 1);
+
+            drawFrame({1}, true);
+            REQUIRE(batch.getUploadedVertexCount() == 0);
+            REQUIRE(batch.getDrawCallCount() == 1);
+        }
+    #endif
+    }
+
+    SECTION("Geometry versions")
+    {
+        tgui::priv::RenderBatch batch;
+        const sf::Vertex vertices[] = {{{0, 0}}, {{0, 10}}, {{10, 0}}, {{10, 10}}};
+
+        const auto drawFrame = [&](std::size_t version){
+            batch.begin(target);
+            batch.addTriangleStrip(vertices, 4, {}, version);
+            batch.end();
+        };
+
+        const std::size_t version = tgui::priv::RenderBatch::createGeometryVersion();
+        REQUIRE(tgui::priv::RenderBatch::createGeometryVersion() != version);
+
+        drawFrame(version);
+        REQUIRE(batch.getUploadedVertexCount() >= 6);
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        if (sf::VertexBuffer::isAvailable())
+        {
+            // Geometry of which the version didn't change is drawn from the vertex buffer without being written again
+            drawFrame(version);
+            REQUIRE(batch.getUploadedVertexCount() == 0);
+
+            drawFrame(tgui::priv::RenderBatch::createGeometryVersion());
+            REQUIRE(batch.getUploadedVertexCount() == 6);
+
+            // Geometry without a version is always written again
+            drawFrame(0);
+            REQUIRE(batch.getUploadedVertexCount() == 6);
+            drawFrame(0);
+            REQUIRE(batch.getUploadedVertexCount() == 6);
+        }
+    #endif
+    }
+
+    SECTION("Vertex buffer size with geometry that is recreated every frame")
+    {
+        tgui::priv::RenderBatch batch;
+        const int owners[10] = {};
+        std::vector<int> temporaryOwners(300);
+
+        // The last owner is different in every frame, like a tool tip or popup that is created again each time
+        const auto drawFrame = [&](std::size_t frame){
+            batch.begin(target);
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                const tgui::priv::RenderBatch::OwnerScope ownerScope{&batch, &owners[i]};
+                batch.addRectangle({4, 4}, sf::Color::Red, sf::Transform().translate(i * 4.f, 0));
+            }
+            {
+                const tgui::priv::RenderBatch::OwnerScope ownerScope{&batch, &temporaryOwners[frame]};
+                batch.addRectangle({4, 4}, sf::Color::Blue, sf::Transform().translate(0, 10));
+            }
+            batch.end();
+        };
+
+        for (std::size_t frame = 0; frame < 100; ++frame)
+            drawFrame(frame);
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        if (sf::VertexBuffer::isAvailable())
+        {
+            // The gaps left by the released slots are reclaimed, so the buffer stops growing
+            const std::size_t bufferSize = batch.getVertexBufferSize();
+            REQUIRE(bufferSize <= 4 * 66);
+
+            for (std::size_t frame = 100; frame < temporaryOwners.size(); ++frame)
+                drawFrame(frame);
+
+            REQUIRE(batch.getVertexBufferSize() == bufferSize);
+        }
+    #endif
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui{target};
+
+        tgui::Texture texture{"resources/image.png"};
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            auto picture = tgui::Picture::create(texture);
+            picture->setPosition(i * 10.f, i * 10.f);
+            picture->setSize(10, 10);
+            gui.add(picture);
+        }
+
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() == 1);
+
+        gui.draw();
+        REQUIRE(gui.getDrawAllocationCount() == 0);
+
+        // Texts, borders, nine-slice images and clipping don't allocate anything once the first frame was drawn
+        auto panel = tgui::Panel::create({40, 40});
+        panel->getRenderer()->setBorders({1});
+        gui.add(panel);
+
+        auto label = tgui::Label::create("Label");
+        label->setPosition(30, 0);
+        panel->add(label);
+
+        auto button = tgui::Button::create("Button");
+        button->getRenderer()->setTexture({"resources/image.png", {}, {10, 10, 30, 30}});
+        panel->add(button);
+
+        gui.draw();
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            gui.draw();
+            REQUIRE(gui.getDrawAllocationCount() == 0);
+        }
+    }
+}
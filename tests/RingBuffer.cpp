@@ -0,0 +1,144 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/RingBuffer.hpp>
+#include <memory>
+
+namespace
+{
+    std::vector<int> getElements(const tgui::priv::RingBuffer<int>& buffer)
+    {
+        std::vector<int> elements;
+        for (std::size_t i = 0; i < buffer.getSize(); ++i)
+            elements.push_back(buffer[i]);
+
+        return elements;
+    }
+}
+
+TEST_CASE("[RingBuffer]")
+{
+    tgui::priv::RingBuffer<int> buffer;
+    REQUIRE(buffer.getSize() == 0);
+    REQUIRE(buffer.getCapacity() == 0);
+
+    buffer.setCapacity(4);
+    REQUIRE(buffer.getCapacity() == 4);
+
+    SECTION("Push front")
+    {
+        buffer.pushBack(1);
+        buffer.pushBack(2);
+
+        // The first element wraps around to the end of the storage
+        buffer.pushFront(0);
+        buffer.pushFront(-1);
+        REQUIRE(buffer.getCapacity() == 4);
+        REQUIRE(getElements(buffer) == std::vector<int>{-1, 0, 1, 2});
+
+        // The buffer grows when it is full
+        buffer.pushFront(-2);
+        REQUIRE(buffer.getCapacity() == 8);
+        REQUIRE(getElements(buffer) == std::vector<int>{-2, -1, 0, 1, 2});
+
+        buffer.popBack();
+        buffer.popFront();
+        REQUIRE(getElements(buffer) == std::vector<int>{-1, 0, 1});
+    }
+
+    SECTION("Wrapped")
+    {
+        for (int i = 1; i <= 4; ++i)
+            buffer.pushBack(i);
+
+        // The slots of the removed elements are reused
+        buffer.popFront();
+        buffer.popFront();
+        buffer.pushBack(5);
+        buffer.pushBack(6);
+        REQUIRE(buffer.getCapacity() == 4);
+        REQUIRE(getElements(buffer) == std::vector<int>{3, 4, 5, 6});
+
+        SECTION("Erase")
+        {
+            // Element in the first half
+            buffer.erase(1);
+            REQUIRE(getElements(buffer) == std::vector<int>{3, 5, 6});
+
+            // Element in the second half
+            buffer.erase(1);
+            REQUIRE(getElements(buffer) == std::vector<int>{3, 6});
+
+            buffer.erase(1);
+            buffer.erase(0);
+            REQUIRE(buffer.getSize() == 0);
+
+            buffer.pushBack(7);
+            buffer.pushFront(8);
+            REQUIRE(buffer.getCapacity() == 4);
+            REQUIRE(getElements(buffer) == std::vector<int>{8, 7});
+        }
+
+        SECTION("Set capacity")
+        {
+            buffer.setCapacity(8);
+            REQUIRE(buffer.getCapacity() == 8);
+            REQUIRE(getElements(buffer) == std::vector<int>{3, 4, 5, 6});
+
+            buffer.pushBack(7);
+            buffer.pushFront(2);
+            REQUIRE(getElements(buffer) == std::vector<int>{2, 3, 4, 5, 6, 7});
+
+            // The capacity never becomes smaller than the amount of elements
+            buffer.setCapacity(2);
+            REQUIRE(buffer.getCapacity() == 6);
+            REQUIRE(getElements(buffer) == std::vector<int>{2, 3, 4, 5, 6, 7});
+        }
+
+        SECTION("Clear")
+        {
+            buffer.clear();
+            REQUIRE(buffer.getSize() == 0);
+            REQUIRE(buffer.getCapacity() == 4);
+        }
+    }
+
+    SECTION("Removed elements are released")
+    {
+        auto element = std::make_shared<int>(0);
+
+        tgui::priv::RingBuffer<std::shared_ptr<int>> pointers;
+        pointers.pushBack(element);
+        pointers.pushBack(element);
+        pointers.pushBack(element);
+        REQUIRE(element.use_count() == 4);
+
+        pointers.popFront();
+        pointers.popBack();
+        pointers.erase(0);
+        REQUIRE(element.use_count() == 1);
+    }
+}
@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/RowCache.hpp>
+
+namespace
+{
+    // Data source that only answers the requests when told to, like a database running on another thread would
+    struct DelayedDataSource : public tgui::DataSource
+    {
+        std::size_t getRowCount() const override
+        {
+            return rowCount;
+        }
+
+        void fetchRows(std::size_t firstRow, std::size_t count, FetchCallback callback) override
+        {
+            requests.push_back({firstRow, count});
+            callbacks.push_back(callback);
+        }
+
+        void answer()
+        {
+            const std::size_t firstUnanswered = requests.size() - callbacks.size();
+            for (std::size_t i = 0; i < callbacks.size(); ++i)
+            {
+                const auto& request = requests[firstUnanswered + i];
+
+                std::vector<sf::String> rows;
+                for (std::size_t row = request.first; row < request.first + request.second; ++row)
+                    rows.push_back("Row " + tgui::to_string(row));
+
+                callbacks[i](rows);
+            }
+
+            callbacks.clear();
+        }
+
+        std::size_t rowCount = 0;
+        std::vector<std::pair<std::size_t, std::size_t>> requests;
+        std::vector<FetchCallback> callbacks; // Callbacks of the last requests, which haven't been answered yet
+    };
+}
+
+TEST_CASE("[RowCache]")
+{
+    auto dataSource = std::make_shared<DelayedDataSource>();
+    dataSource->rowCount = 100;
+
+    tgui::priv::RowCache cache(10, 3);
+    cache.setDataSource(dataSource);
+    REQUIRE(cache.getDataSource() == dataSource);
+    REQUIRE(cache.getRowCount() == 100);
+    REQUIRE(cache.getMaximumRows() == 30);
+
+    SECTION("Fetching rows")
+    {
+        REQUIRE(cache.requestRows(5, 15));
+        REQUIRE(dataSource->requests == std::vector<std::pair<std::size_t, std::size_t>>{{0, 10}, {10, 10}});
+        REQUIRE(cache.isFetching());
+        REQUIRE(cache.getRow(5) == nullptr);
+
+        // The widget checks for the rows regularly, but without spinning
+        REQUIRE(cache.getTimeUntilNextPoll() > sf::Time::Zero);
+        REQUIRE(cache.getTimeUntilNextPoll() <= sf::milliseconds(100));
+
+        // Rows that are already being fetched aren't requested again
+        REQUIRE(!cache.requestRows(0, 20));
+        REQUIRE(dataSource->requests.size() == 2);
+
+        dataSource->answer();
+        REQUIRE(cache.getRow(5) == nullptr);
+        REQUIRE(cache.applyFetchedRows());
+        REQUIRE(!cache.isFetching());
+        REQUIRE(cache.getTimeUntilNextPoll() > sf::seconds(3600));
+        REQUIRE(*cache.getRow(5) == "Row 5");
+        REQUIRE(*cache.getRow(19) == "Row 19");
+        REQUIRE(cache.getRow(20) == nullptr);
+        REQUIRE(!cache.requestRows(0, 20));
+    }
+
+    SECTION("Requesting more rows than the cache can hold")
+    {
+        // Only the pages in the middle of the range are fetched
+        REQUIRE(cache.requestRows(0, 100));
+        REQUIRE(dataSource->requests == std::vector<std::pair<std::size_t, std::size_t>>{{30, 10}, {40, 10}, {50, 10}});
+
+        dataSource->answer();
+        REQUIRE(cache.applyFetchedRows());
+        REQUIRE(cache.getLoadedPageCount() == 3);
+
+        // The pages don't replace each other, so requesting the same range again doesn't fetch anything
+        REQUIRE(!cache.requestRows(0, 100));
+        REQUIRE(dataSource->requests.size() == 3);
+        REQUIRE(*cache.getRow(30) == "Row 30");
+        REQUIRE(*cache.getRow(59) == "Row 59");
+    }
+
+    SECTION("Least recently used pages are forgotten")
+    {
+        cache.requestRows(0, 30);
+        dataSource->answer();
+        cache.applyFetchedRows();
+        REQUIRE(cache.getLoadedPageCount() == 3);
+
+        cache.requestRows(0, 10);
+        cache.requestRows(30, 40);
+        dataSource->answer();
+        cache.applyFetchedRows();
+        REQUIRE(cache.getLoadedPageCount() == 3);
+        REQUIRE(cache.getRow(0) != nullptr);
+        REQUIRE(cache.getRow(10) == nullptr);
+        REQUIRE(cache.getRow(20) != nullptr);
+        REQUIRE(*cache.getRow(35) == "Row 35");
+
+        cache.setMaximumRows(10);
+        REQUIRE(cache.getLoadedPageCount() == 1);
+        REQUIRE(cache.getRow(35) != nullptr);
+    }
+
+    SECTION("Row count changes")
+    {
+        dataSource->rowCount = 25;
+        REQUIRE(cache.updateRowCount());
+        REQUIRE(!cache.updateRowCount());
+
+        cache.requestRows(0, 100);
+        REQUIRE(dataSource->requests.back() == std::make_pair<std::size_t, std::size_t>(20, 5));
+        dataSource->answer();
+        cache.applyFetchedRows();
+        REQUIRE(*cache.getRow(24) == "Row 24");
+
+        // The incomplete last page is fetched again when rows are added to it
+        dataSource->rowCount = 28;
+        REQUIRE(cache.updateRowCount());
+        REQUIRE(cache.getRow(24) == nullptr);
+        REQUIRE(cache.requestRows(20, 28));
+        dataSource->answer();
+        cache.applyFetchedRows();
+        REQUIRE(*cache.getRow(27) == "Row 27");
+    }
+
+    SECTION("Replacing the data source")
+    {
+        cache.requestRows(0, 10);
+        cache.setDataSource(nullptr);
+        REQUIRE(cache.getRowCount() == 0);
+        REQUIRE(!cache.isFetching());
+
+        // Rows of the old data source that arrive late are ignored
+        dataSource->answer();
+        REQUIRE(!cache.applyFetchedRows());
+        REQUIRE(cache.getLoadedPageCount() == 0);
+        REQUIRE(!cache.requestRows(0, 10));
+    }
+
+    SECTION("Copying")
+    {
+        cache.requestRows(0, 10);
+        dataSource->answer();
+        cache.applyFetchedRows();
+        cache.requestRows(10, 20);
+
+        tgui::priv::RowCache copy(cache);
+        REQUIRE(*copy.getRow(0) == "Row 0");
+        REQUIRE(!copy.isFetching());
+
+        // The copy doesn't receive the rows that the original requested
+        dataSource->answer();
+        REQUIRE(!copy.applyFetchedRows());
+        REQUIRE(cache.applyFetchedRows());
+        REQUIRE(*cache.getRow(10) == "Row 10");
+        REQUIRE(copy.getRow(10) == nullptr);
+    }
+}
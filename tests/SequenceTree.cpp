@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/SequenceTree.hpp>
+
+namespace
+{
+    std::vector<std::size_t> getPayloads(const tgui::priv::SequenceTree& tree)
+    {
+        std::vector<std::size_t> payloads;
+        for (const auto handle : tree.getHandles())
+            payloads.push_back(tree.getPayload(handle));
+
+        return payloads;
+    }
+}
+
+TEST_CASE("[SequenceTree]")
+{
+    tgui::priv::SequenceTree tree;
+    REQUIRE(tree.getSize() == 0);
+    REQUIRE(tree.getCountedSize() == 0);
+    REQUIRE(tree.getCountedWeight() == 0);
+
+    SECTION("Insert and erase")
+    {
+        const std::size_t handle1 = tree.insert(0, 1, 10, true);
+        const std::size_t handle3 = tree.insert(1, 3, 30, true);
+        const std::size_t handle2 = tree.insert(1, 2, 20, false);
+        const std::size_t handle0 = tree.insert(0, 0, 5, true);
+        REQUIRE(getPayloads(tree) == std::vector<std::size_t>{0, 1, 2, 3});
+        REQUIRE(tree.getSize() == 4);
+        REQUIRE(tree.getCountedSize() == 3);
+        REQUIRE(tree.getCountedWeight() == 45);
+
+        REQUIRE(tree.at(2) == handle2);
+        REQUIRE(tree.getPosition(handle3) == 3);
+        REQUIRE(tree.atCounted(2) == handle3);
+        REQUIRE(tree.getCountedPosition(handle3) == 2);
+
+        // Handles stay valid when elements are removed in front of them
+        tree.erase(handle0);
+        REQUIRE(getPayloads(tree) == std::vector<std::size_t>{1, 2, 3});
+        REQUIRE(tree.getPosition(handle1) == 0);
+        REQUIRE(tree.getPosition(handle3) == 2);
+        REQUIRE(tree.getCountedWeight() == 40);
+
+        tree.clear();
+        REQUIRE(tree.getSize() == 0);
+    }
+
+    SECTION("Weights")
+    {
+        tree.build({{0, 10, true}, {1, 20, false}, {2, 0, true}, {3, 5, true}});
+        REQUIRE(tree.getCountedWeightBefore(0) == 0);
+        REQUIRE(tree.getCountedWeightBefore(1) == 10);
+        REQUIRE(tree.getCountedWeightBefore(2) == 10);
+        REQUIRE(tree.getCountedWeightBefore(3) == 15);
+
+        // Elements that aren't counted are skipped, like rows without height
+        REQUIRE(tree.findCountedAtWeight(0) == 0);
+        REQUIRE(tree.findCountedAtWeight(9) == 0);
+        REQUIRE(tree.findCountedAtWeight(10) == 2);
+        REQUIRE(tree.findCountedAtWeight(14) == 2);
+        REQUIRE(tree.findCountedAtWeight(15) == 3);
+
+        tree.setWeight(tree.at(1), 20, true);
+        REQUIRE(tree.getCountedSize() == 4);
+        REQUIRE(tree.getCountedWeight() == 35);
+        REQUIRE(tree.findCountedAtWeight(10) == 1);
+    }
+
+    SECTION("Find first")
+    {
+        for (std::size_t i = 0; i < 1000; ++i)
+            tree.insert(tree.getSize(), 2 * i, 1, true);
+
+        // The position at which a value would be inserted in the sorted sequence
+        const auto findInsertPosition = [&tree](std::size_t value){
+            return tree.findFirst([&tree,value](std::size_t handle){ return value < tree.getPayload(handle); });
+        };
+
+        REQUIRE(findInsertPosition(0) == 1);
+        REQUIRE(findInsertPosition(501) == 251);
+        REQUIRE(findInsertPosition(5000) == 1000);
+
+        tree.insert(findInsertPosition(501), 501, 1, true);
+        REQUIRE(tree.getPayload(tree.at(251)) == 501);
+        REQUIRE(tree.getPayload(tree.at(252)) == 502);
+    }
+
+    SECTION("Many elements")
+    {
+        std::vector<tgui::priv::SequenceTree::Element> elements;
+        for (std::size_t i = 0; i < 10000; ++i)
+            elements.push_back({i, 1, (i % 2) == 0});
+
+        const std::vector<std::size_t> handles = tree.build(elements);
+        REQUIRE(tree.getCountedSize() == 5000);
+
+        // Remove every third element, the others keep their order
+        for (std::size_t i = 0; i < handles.size(); i += 3)
+            tree.erase(handles[i]);
+
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < 10000; ++i)
+        {
+            if ((i % 3) != 0)
+                expected.push_back(i);
+        }
+
+        REQUIRE(getPayloads(tree) == expected);
+        for (std::size_t i = 1; i < handles.size(); i += 3)
+            REQUIRE(tree.getPayload(tree.at(tree.getPosition(handles[i]))) == i);
+    }
+}
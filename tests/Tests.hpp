@@ -26,6 +26,7 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DataSource.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -63,6 +64,28 @@ void testClickableWidgetSignals(tgui::ClickableWidget::Ptr widget);
 
 void testWidgetRenderer(tgui::WidgetRenderer* renderer);
 
+// Data source that immediately provides the requested rows
+struct NumberedRows : public tgui::DataSource
+{
+    std::size_t getRowCount() const override
+    {
+        return rowCount;
+    }
+
+    void fetchRows(std::size_t firstRow, std::size_t count, FetchCallback callback) override
+    {
+        std::vector<sf::String> rows;
+        for (std::size_t row = firstRow; row < firstRow + count; ++row)
+            rows.push_back("Row " + tgui::to_string(row));
+
+        fetchedRowCount += count;
+        callback(rows);
+    }
+
+    std::size_t rowCount = 0;
+    std::size_t fetchedRowCount = 0;
+};
+
 template <typename WidgetType>
 void testSavingWidget(std::string name, std::shared_ptr<WidgetType> widget, bool loadFromTheme = true)
 {
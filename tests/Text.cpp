@@ -135,4 +135,22 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("findBestTextSize")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        REQUIRE(tgui::Text::findBestTextSize(nullptr, 20) == 0);
+        REQUIRE(tgui::Text::findBestTextSize(font, 1) == 1);
+
+        const unsigned int textSize = tgui::Text::findBestTextSize(font, 30);
+        REQUIRE(textSize > 10);
+        REQUIRE(textSize < 30);
+        REQUIRE(tgui::Text::findBestTextSize(font, 30, -1) <= textSize);
+        REQUIRE(tgui::Text::findBestTextSize(font, 30, 1) >= textSize);
+
+        // The cached result is the same as the calculated one
+        REQUIRE(tgui::Text::findBestTextSize(font, 30) == textSize);
+        tgui::Text::clearBestTextSizeCache();
+        REQUIRE(tgui::Text::findBestTextSize(font, 30) == textSize);
+    }
 }
@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TextLayoutCache.hpp>
+#include <TGUI/Text.hpp>
+
+TEST_CASE("[TextLayoutCache]")
+{
+    tgui::TextLayoutCache::clear();
+    tgui::TextLayoutCache::resetStatistics();
+
+    tgui::Text text1;
+    text1.setFont("resources/DejaVuSans.ttf");
+    text1.setString("Cancel");
+
+    SECTION("Statistics")
+    {
+        REQUIRE(tgui::TextLayoutCache::getMissCount() == 0);
+
+        const sf::Vector2f size = text1.getSize();
+        REQUIRE(tgui::TextLayoutCache::getMissCount() == 1);
+        REQUIRE(tgui::TextLayoutCache::getHitCount() == 0);
+
+        // The layout is only looked up again when a property of the text changes
+        text1.getSize();
+        REQUIRE(tgui::TextLayoutCache::getMissCount() == 1);
+
+        tgui::Text text2;
+        text2.setFont(text1.getFont());
+        text2.setString("Cancel");
+        REQUIRE(text2.getSize() == size);
+        REQUIRE(tgui::TextLayoutCache::getHitCount() == 1);
+
+        text2.setStyle(sf::Text::Bold);
+        REQUIRE(text2.getSize() != size);
+        REQUIRE(tgui::TextLayoutCache::getMissCount() == 2);
+
+        tgui::TextLayoutCache::resetStatistics();
+        REQUIRE(tgui::TextLayoutCache::getHitCount() == 0);
+        REQUIRE(tgui::TextLayoutCache::getMissCount() == 0);
+    }
+
+    SECTION("Memory budget")
+    {
+        const std::size_t oldBudget = tgui::TextLayoutCache::getMemoryBudget();
+
+        text1.getSize();
+        REQUIRE(tgui::TextLayoutCache::getMemoryUsage() > 0);
+
+        tgui::TextLayoutCache::setMemoryBudget(0);
+        REQUIRE(tgui::TextLayoutCache::getMemoryUsage() == 0);
+
+        // The text keeps its layout when it is removed from the cache
+        const sf::Vector2f size = text1.getSize();
+        REQUIRE(size.x > 0);
+
+        tgui::Text text2 = text1;
+        text2.setString("OK");
+        text2.getSize();
+        REQUIRE(tgui::TextLayoutCache::getMemoryUsage() == 0);
+
+        tgui::TextLayoutCache::setMemoryBudget(oldBudget);
+        text2.setString("Cancel");
+        REQUIRE(text2.getSize() == size);
+        REQUIRE(tgui::TextLayoutCache::getMemoryUsage() > 0);
+    }
+}
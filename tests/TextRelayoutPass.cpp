@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/TextRelayoutPass.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <algorithm>
+
+TEST_CASE("[TextRelayoutPass]")
+{
+    const sf::String paragraph = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\n";
+
+    SECTION("ThreadCount")
+    {
+        REQUIRE(tgui::TextRelayoutPass::getThreadCount() >= 1);
+
+        tgui::TextRelayoutPass::setThreadCount(3);
+        REQUIRE(tgui::TextRelayoutPass::getThreadCount() == 3);
+
+        tgui::TextRelayoutPass::setThreadCount(0);
+        REQUIRE(tgui::TextRelayoutPass::getThreadCount() >= 1);
+    }
+
+    SECTION("Worker threads")
+    {
+        // The workers are kept between calls and restarted when the amount of threads changes
+        for (unsigned int threadCount : {4u, 4u, 2u, 1u})
+        {
+            tgui::TextRelayoutPass::setThreadCount(threadCount);
+            for (unsigned int run = 0; run < 3; ++run)
+            {
+                std::vector<unsigned int> calls(100, 0);
+                tgui::TextRelayoutPass::parallelFor(calls.size(), 100000, [&](std::size_t i){ ++calls[i]; });
+                REQUIRE(std::count(calls.begin(), calls.end(), 1u) == 100);
+            }
+        }
+
+        tgui::TextRelayoutPass::setThreadCount(0);
+    }
+
+    SECTION("Deferred wrapping")
+    {
+        auto label = tgui::Label::create(paragraph + paragraph);
+        label->setTextSize(16);
+        const sf::Vector2f unwrappedSize = label->getSize();
+
+        REQUIRE(!tgui::TextRelayoutPass::isActive());
+        {
+            tgui::TextRelayoutPass::Scope outerPass;
+            {
+                tgui::TextRelayoutPass::Scope innerPass;
+                REQUIRE(tgui::TextRelayoutPass::isActive());
+
+                label->setMaximumTextWidth(150);
+                REQUIRE(label->getSize() == unwrappedSize);
+            }
+
+            // Nothing happens until the outermost pass ends
+            REQUIRE(label->getSize() == unwrappedSize);
+        }
+        REQUIRE(!tgui::TextRelayoutPass::isActive());
+        REQUIRE(label->getSize() != unwrappedSize);
+
+        auto label2 = tgui::Label::create(paragraph + paragraph);
+        label2->setTextSize(16);
+        label2->setMaximumTextWidth(150);
+        REQUIRE(label->getSize() == label2->getSize());
+    }
+
+    SECTION("Destroyed while queued")
+    {
+        auto expectedLabel = tgui::Label::create(paragraph);
+        expectedLabel->setMaximumTextWidth(100);
+
+        auto otherLabel = tgui::Label::create(paragraph);
+        {
+            tgui::TextRelayoutPass::Scope pass;
+
+            auto label = tgui::Label::create(paragraph);
+            label->setMaximumTextWidth(100);
+            otherLabel->setMaximumTextWidth(100);
+            label = nullptr;
+        }
+
+        // The label that still exists was wrapped when the pass ended
+        REQUIRE(!tgui::TextRelayoutPass::isActive());
+        REQUIRE(otherLabel->getSize() == expectedLabel->getSize());
+    }
+
+    SECTION("Overwritten while queued")
+    {
+        auto label = tgui::Label::create(paragraph);
+        auto otherLabel = tgui::Label::create(paragraph);
+        otherLabel->setMaximumTextWidth(200);
+        {
+            tgui::TextRelayoutPass::Scope pass;
+
+            // The request of the overwritten label would otherwise use its old maximum width for the new text
+            label->setMaximumTextWidth(100);
+            *label = *otherLabel;
+        }
+
+        REQUIRE(label->getSize() == otherLabel->getSize());
+    }
+
+    SECTION("Same result as serial wrapping")
+    {
+        // Enough text to make the pass use multiple threads
+        sf::String text;
+        for (unsigned int i = 0; i < 10; ++i)
+            text += paragraph;
+
+        std::vector<tgui::Label::Ptr> serialLabels;
+        std::vector<tgui::TextBox::Ptr> serialTextBoxes;
+        for (unsigned int i = 0; i < 8; ++i)
+        {
+            serialLabels.push_back(tgui::Label::create(text));
+            serialLabels.back()->setMaximumTextWidth(100.f + 20*i);
+
+            serialTextBoxes.push_back(tgui::TextBox::create());
+            serialTextBoxes.back()->setText(text);
+            serialTextBoxes.back()->setSize(100.f + 20*i, 300);
+        }
+
+        tgui::TextRelayoutPass::setThreadCount(4);
+
+        std::vector<tgui::Label::Ptr> labels;
+        std::vector<tgui::TextBox::Ptr> textBoxes;
+        {
+            tgui::TextRelayoutPass::Scope pass;
+            for (unsigned int i = 0; i < 8; ++i)
+            {
+                labels.push_back(tgui::Label::create(text));
+                labels.back()->setMaximumTextWidth(100.f + 20*i);
+
+                textBoxes.push_back(tgui::TextBox::create());
+                textBoxes.back()->setText(text);
+                textBoxes.back()->setSize(100.f + 20*i, 300);
+            }
+        }
+
+        tgui::TextRelayoutPass::setThreadCount(0);
+
+        for (unsigned int i = 0; i < 8; ++i)
+        {
+            REQUIRE(labels[i]->getSize() == serialLabels[i]->getSize());
+            REQUIRE(textBoxes[i]->getLinesCount() == serialTextBoxes[i]->getLinesCount());
+        }
+    }
+}
@@ -53,3 +53,65 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 }
+
+TEST_CASE("[TextureManager] Atlas")
+{
+    REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+    REQUIRE(tgui::TextureManager::getAtlasPageSize() == 1024);
+    REQUIRE(tgui::TextureManager::getAtlasPadding() == 1);
+
+    tgui::TextureManager::setAtlasEnabled(true);
+    REQUIRE(tgui::TextureManager::isAtlasEnabled());
+
+    SECTION("Packing")
+    {
+        tgui::Texture texture1{"resources/image.png"};
+        tgui::Texture texture2{"resources/TransparentParts.png", {10, 10, 30, 30}};
+        tgui::Texture texture3{"resources/TransparentParts.png", {0, 0, 20, 20}};
+
+        REQUIRE(texture1.getData()->atlasTexture != nullptr);
+        REQUIRE(texture1.getData()->atlasTexture == texture2.getData()->atlasTexture);
+        REQUIRE(texture1.getData()->atlasTexture == texture3.getData()->atlasTexture);
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+
+        REQUIRE(texture1.getImageSize() == sf::Vector2f(50, 50));
+        REQUIRE(texture2.getImageSize() == sf::Vector2f(30, 30));
+        REQUIRE(texture2.getMiddleRect() == sf::IntRect(0, 0, 30, 30));
+        REQUIRE(texture2.getData()->atlasRect.width == 30);
+        REQUIRE(texture2.getData()->atlasRect.height == 30);
+
+        // The images don't overlap and are surrounded by padding
+        REQUIRE(!texture1.getData()->atlasRect.intersects(texture2.getData()->atlasRect));
+        REQUIRE(!texture2.getData()->atlasRect.intersects(texture3.getData()->atlasRect));
+        REQUIRE(texture1.getData()->atlasRect.left >= 1);
+        REQUIRE(texture1.getData()->atlasRect.top >= 1);
+
+        // Transparency is still checked on the original image
+        sf::Image image;
+        image.loadFromFile("resources/TransparentParts.png");
+        for (unsigned int x = 0; x < 30; ++x)
+        {
+            for (unsigned int y = 0; y < 30; ++y)
+                REQUIRE(texture2.isTransparentPixel({x, y}) == (image.getPixel(x + 10, y + 10).a == 0));
+        }
+
+        // Smooth textures can't be part of the atlas
+        REQUIRE(!texture1.isSmooth());
+        texture1.setSmooth(true);
+        REQUIRE(texture1.isSmooth());
+        REQUIRE(texture1.getData()->atlasTexture == nullptr);
+        REQUIRE(texture1.getImageSize() == sf::Vector2f(50, 50));
+    }
+
+    SECTION("Large images")
+    {
+        tgui::TextureManager::setAtlasPageSize(32);
+        tgui::Texture texture{"resources/image.png"};
+        REQUIRE(texture.getData()->atlasTexture == nullptr);
+        REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
+        tgui::TextureManager::setAtlasPageSize(1024);
+    }
+
+    REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+    tgui::TextureManager::setAtlasEnabled(false);
+}
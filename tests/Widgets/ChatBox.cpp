@@ -25,6 +25,45 @@
 #include "../Tests.hpp"
 #include <TGUI/Widgets/ChatBox.hpp>
 
+namespace
+{
+    // Gives the tests access to the scrollbar and the height of the lines
+    class ChatBoxInternals : public tgui::ChatBox
+    {
+    public:
+        using ChatBox::getVisibleLines;
+
+        void setScrollbarValue(unsigned int value)
+        {
+            m_scroll.setValue(value);
+        }
+
+        unsigned int getScrollbarValue() const
+        {
+            return m_scroll.getValue();
+        }
+
+        unsigned int getScrollbarMaximum() const
+        {
+            return m_scroll.getMaximum();
+        }
+
+        float getLineHeight(std::size_t lineIndex) const
+        {
+            return m_lines[lineIndex].height;
+        }
+
+        double getSumOfLineHeights() const
+        {
+            double sum = 0;
+            for (std::size_t i = 0; i < m_lines.getSize(); ++i)
+                sum += m_lines[i].height;
+
+            return sum;
+        }
+    };
+}
+
 TEST_CASE("[ChatBox]")
 {
     tgui::ChatBox::Ptr chatBox = tgui::ChatBox::create();
@@ -150,6 +189,37 @@ TEST_CASE("[ChatBox]")
             REQUIRE(chatBox->getLine(0) == "Line 4");
             REQUIRE(chatBox->getLine(1) == "Line 3");
         }
+
+        SECTION("Many lines")
+        {
+            auto longChatBox = std::make_shared<ChatBoxInternals>();
+            longChatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+
+            // The lines have different heights, which the scrollbar has to keep adding up
+            longChatBox->setLineLimit(100);
+            for (unsigned int i = 0; i < 1000; ++i)
+                longChatBox->addLine("Line " + tgui::to_string(i), 10 + (i % 3) * 10);
+
+            REQUIRE(longChatBox->getLineAmount() == 100);
+            REQUIRE(longChatBox->getLine(0) == "Line 900");
+            REQUIRE(longChatBox->getLine(99) == "Line 999");
+            REQUIRE(longChatBox->getScrollbarMaximum() == static_cast<unsigned int>(longChatBox->getSumOfLineHeights()));
+
+            REQUIRE(longChatBox->removeLine(50));
+            REQUIRE(longChatBox->getLine(50) == "Line 951");
+            REQUIRE(longChatBox->getScrollbarMaximum() == static_cast<unsigned int>(longChatBox->getSumOfLineHeights()));
+
+            longChatBox->setLineLimit(10);
+            REQUIRE(longChatBox->getLineAmount() == 10);
+            REQUIRE(longChatBox->getLine(0) == "Line 990");
+            REQUIRE(longChatBox->getScrollbarMaximum() == static_cast<unsigned int>(longChatBox->getSumOfLineHeights()));
+
+            longChatBox->addLine("Line 1000");
+            REQUIRE(longChatBox->getLineAmount() == 10);
+            REQUIRE(longChatBox->getLine(0) == "Line 991");
+            REQUIRE(longChatBox->getLine(9) == "Line 1000");
+            REQUIRE(longChatBox->getScrollbarMaximum() == static_cast<unsigned int>(longChatBox->getSumOfLineHeights()));
+        }
     }
 
     SECTION("Default text size")
@@ -186,6 +256,74 @@ TEST_CASE("[ChatBox]")
         REQUIRE(chatBox->getLineFont(4) == font1);
     }
 
+    SECTION("Visible lines")
+    {
+        auto longChatBox = std::make_shared<ChatBoxInternals>();
+        longChatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        longChatBox->getRenderer()->setBorders(0);
+        longChatBox->getRenderer()->setPadding(0);
+        longChatBox->setSize(200, 100);
+
+        // Finds the line by adding up the heights instead of searching the positions that the chat box stores
+        auto findLineAtOffset = [&](double offset){
+            std::size_t lineIndex = 0;
+            double top = 0;
+            for (std::size_t i = 0; i < longChatBox->getLineAmount(); ++i)
+            {
+                if (top <= offset)
+                    lineIndex = i;
+
+                top += longChatBox->getLineHeight(i);
+            }
+            return lineIndex;
+        };
+
+        auto checkVisibleLines = [&](unsigned int scrollValue){
+            longChatBox->setScrollbarValue(scrollValue);
+            const auto visibleLines = longChatBox->getVisibleLines();
+            REQUIRE(visibleLines.first == findLineAtOffset(longChatBox->getScrollbarValue()));
+            REQUIRE(visibleLines.second == findLineAtOffset(longChatBox->getScrollbarValue() + 100.0));
+            return visibleLines;
+        };
+
+        SECTION("Oldest on top")
+        {
+            for (unsigned int i = 0; i < 1000; ++i)
+                longChatBox->addLine("Line " + tgui::to_string(i), 10 + (i % 3) * 10);
+
+            REQUIRE(longChatBox->getLine(checkVisibleLines(0).first) == "Line 0");
+            checkVisibleLines(5000);
+            REQUIRE(longChatBox->getLine(checkVisibleLines(longChatBox->getScrollbarMaximum() - 100).second) == "Line 999");
+
+            // Remove lines in both halves, which move the lines on different sides of them
+            REQUIRE(longChatBox->removeLine(200));
+            REQUIRE(longChatBox->removeLine(700));
+            REQUIRE(longChatBox->getLine(checkVisibleLines(0).first) == "Line 0");
+            checkVisibleLines(5000);
+            checkVisibleLines(15000);
+            REQUIRE(longChatBox->getLine(checkVisibleLines(longChatBox->getScrollbarMaximum() - 100).second) == "Line 999");
+        }
+
+        SECTION("Newest on top")
+        {
+            // The positions of the lines become negative when new lines are added above the others
+            longChatBox->setNewLinesBelowOthers(false);
+            for (unsigned int i = 0; i < 1000; ++i)
+                longChatBox->addLine("Line " + tgui::to_string(i), 10 + (i % 3) * 10);
+
+            REQUIRE(longChatBox->getLine(checkVisibleLines(0).first) == "Line 999");
+            checkVisibleLines(5000);
+            REQUIRE(longChatBox->getLine(checkVisibleLines(longChatBox->getScrollbarMaximum() - 100).second) == "Line 0");
+
+            REQUIRE(longChatBox->removeLine(200));
+            REQUIRE(longChatBox->removeLine(700));
+            REQUIRE(longChatBox->getLine(checkVisibleLines(0).first) == "Line 999");
+            checkVisibleLines(5000);
+            checkVisibleLines(15000);
+            REQUIRE(longChatBox->getLine(checkVisibleLines(longChatBox->getScrollbarMaximum() - 100).second) == "Line 0");
+        }
+    }
+
     SECTION("Lines start from top or bottom")
     {
         REQUIRE(!chatBox->getLinesStartFromTop());
@@ -195,6 +333,38 @@ TEST_CASE("[ChatBox]")
         REQUIRE(!chatBox->getLinesStartFromTop());
     }
 
+    SECTION("Data source")
+    {
+        auto dataSource = std::make_shared<NumberedRows>();
+        dataSource->rowCount = 1000000;
+
+        chatBox->addLine("Line 1");
+
+        unsigned int rowsNeededCount = 0;
+        chatBox->connect("RowsNeeded", [&](){ ++rowsNeededCount; });
+
+        chatBox->setPrefetchDistance(20);
+        REQUIRE(chatBox->getPrefetchDistance() == 20);
+        chatBox->setMaximumCachedRows(1000);
+        REQUIRE(chatBox->getMaximumCachedRows() == 1024);
+
+        chatBox->setDataSource(dataSource);
+        REQUIRE(chatBox->getDataSource() == dataSource);
+        REQUIRE(rowsNeededCount == 1);
+        REQUIRE(dataSource->fetchedRowCount < 256);
+
+        // Adding rows to the data source keeps the chat box scrolled to the bottom, only the last rows are fetched
+        tgui::Widget::Ptr widget = chatBox;
+        dataSource->rowCount = 2000000;
+        widget->update(sf::milliseconds(1));
+        REQUIRE(rowsNeededCount == 2);
+        REQUIRE(dataSource->fetchedRowCount <= 3 * 256);
+
+        chatBox->setDataSource(nullptr);
+        REQUIRE(chatBox->getDataSource() == nullptr);
+        REQUIRE(chatBox->getLineAmount() == 1);
+    }
+
     SECTION("Events / Signals")
     {
         SECTION("Widget")
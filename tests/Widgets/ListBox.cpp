@@ -75,6 +75,11 @@ TEST_CASE("[ListBox]")
         REQUIRE_NOTHROW(listBox->connect("DoubleClicked", [](tgui::Widget::Ptr, std::string, std::string){}));
         REQUIRE_NOTHROW(listBox->connect("DoubleClicked", [](tgui::Widget::Ptr, std::string, sf::String, sf::String){}));
         REQUIRE_NOTHROW(listBox->connect("DoubleClicked", [](tgui::Widget::Ptr, std::string, std::string, std::string){}));
+
+        REQUIRE_NOTHROW(listBox->connect("RowsNeeded", [](){}));
+        REQUIRE_NOTHROW(listBox->connect("RowsNeeded", [](int, int){}));
+        REQUIRE_NOTHROW(listBox->connect("RowsNeeded", [](tgui::Widget::Ptr, std::string){}));
+        REQUIRE_NOTHROW(listBox->connect("RowsNeeded", [](tgui::Widget::Ptr, std::string, int, int){}));
     }
 
     SECTION("WidgetType")
@@ -111,6 +116,35 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getItemById("2") == "Item 2");
         REQUIRE(listBox->getItemById("3") == "");
     }
+
+    SECTION("Many items")
+    {
+        for (unsigned int i = 0; i < 100000; ++i)
+            listBox->addItem("Item " + tgui::to_string(i), tgui::to_string(i));
+
+        REQUIRE(listBox->getItemCount() == 100000);
+        REQUIRE(listBox->getItemById("99999") == "Item 99999");
+
+        listBox->setSelectedItemByIndex(50000);
+        REQUIRE(listBox->getSelectedItem() == "Item 50000");
+        REQUIRE(listBox->getSelectedItemId() == "50000");
+
+        listBox->changeItemByIndex(50000, L"Ítem");
+        REQUIRE(listBox->getSelectedItem() == L"Ítem");
+
+        listBox->removeItemByIndex(0);
+        REQUIRE(listBox->getItemCount() == 99999);
+        REQUIRE(listBox->getSelectedItemIndex() == 49999);
+        REQUIRE(listBox->getItems()[0] == "Item 1");
+
+        REQUIRE(listBox->setSelectedItemById("75000"));
+        REQUIRE(listBox->getSelectedItemIndex() == 74999);
+        REQUIRE(listBox->removeItemById("75001"));
+        REQUIRE(listBox->getItemById("75002") == "Item 75002");
+        REQUIRE(listBox->setSelectedItem("Item 75002"));
+        REQUIRE(listBox->getSelectedItemIndex() == 75000);
+        REQUIRE(!listBox->setSelectedItemById("75001"));
+    }
     
     SECTION("Removing items")
     {
@@ -228,10 +262,185 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getSelectedItemIndex() == -1);
     }
     
+    SECTION("Sorting and filtering")
+    {
+        listBox->addItem("Banana", "1");
+        listBox->addItem("Cherry", "2");
+        listBox->addItem("Apple", "3");
+
+        listBox->setSortComparator([](const sf::String& left, const sf::String& right){ return left < right; });
+        REQUIRE(listBox->getShownItemCount() == 3);
+        REQUIRE(listBox->getItems() == std::vector<sf::String>{"Banana", "Cherry", "Apple"});
+
+        listBox->setFilter("an");
+        REQUIRE(listBox->getFilter() == "an");
+        REQUIRE(listBox->getShownItemCount() == 1);
+        REQUIRE(listBox->getItemCount() == 3);
+
+        listBox->addItem("Mango");
+        REQUIRE(listBox->getShownItemCount() == 2);
+
+        // Indices still refer to the order in which the items were added
+        listBox->setPosition(0, 0);
+        listBox->setSize(200, 300);
+        listBox->setItemHeight(20);
+        listBox->getRenderer()->setBorders(0);
+        listBox->getRenderer()->setPadding(0);
+        listBox->leftMousePressed({10, 25});
+        REQUIRE(listBox->getSelectedItem() == "Mango");
+        REQUIRE(listBox->getSelectedItemIndex() == 3);
+
+        listBox->setFilterPredicate([](const sf::String& item){ return item.getSize() == 5; });
+        REQUIRE(listBox->getFilter() == "");
+        REQUIRE(listBox->getShownItemCount() == 2);
+        listBox->leftMousePressed({10, 5});
+        REQUIRE(listBox->getSelectedItem() == "Apple");
+
+        listBox->setFilter("");
+        listBox->setSortComparator(nullptr);
+        REQUIRE(listBox->getShownItemCount() == 4);
+        listBox->leftMousePressed({10, 5});
+        REQUIRE(listBox->getSelectedItem() == "Banana");
+    }
+
+    SECTION("Data source")
+    {
+        auto dataSource = std::make_shared<NumberedRows>();
+        dataSource->rowCount = 1000000;
+
+        listBox->setPosition(0, 0);
+        listBox->setSize(200, 100);
+        listBox->setItemHeight(20);
+        listBox->getRenderer()->setBorders(0);
+        listBox->getRenderer()->setPadding(0);
+        listBox->addItem("Item");
+
+        unsigned int rowsNeededCount = 0;
+        int lastRowNeeded = 0;
+        listBox->connect("RowsNeeded", [&](int, int last){ ++rowsNeededCount; lastRowNeeded = last; });
+
+        listBox->setDataSource(dataSource);
+        REQUIRE(listBox->getDataSource() == dataSource);
+        REQUIRE(listBox->getShownItemCount() == 1000000);
+        REQUIRE(rowsNeededCount == 1);
+        REQUIRE(lastRowNeeded == 5 + static_cast<int>(listBox->getPrefetchDistance()));
+
+        listBox->leftMousePressed({10, 25});
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+        REQUIRE(listBox->getSelectedItem() == "Row 1");
+        REQUIRE(listBox->getSelectedItemId() == "");
+
+        // Only the rows around the visible ones are fetched
+        tgui::Widget::Ptr widget = listBox;
+        listBox->setSelectedItemByIndex(500000);
+        widget->update(sf::milliseconds(1));
+        REQUIRE(rowsNeededCount == 2);
+        REQUIRE(listBox->getSelectedItem() == "Row 500000");
+        REQUIRE(dataSource->fetchedRowCount < 1000);
+
+        widget->update(sf::milliseconds(1));
+        REQUIRE(rowsNeededCount == 2);
+
+        dataSource->rowCount = 10;
+        widget->update(sf::milliseconds(1));
+        REQUIRE(listBox->getShownItemCount() == 10);
+        REQUIRE(listBox->getSelectedItemIndex() == -1);
+
+        listBox->setDataSource(nullptr);
+        REQUIRE(listBox->getShownItemCount() == 1);
+        REQUIRE(listBox->getDataSource() == nullptr);
+    }
+
+    SECTION("Changing items while a data source is set")
+    {
+        auto dataSource = std::make_shared<NumberedRows>();
+        dataSource->rowCount = 1000000;
+
+        listBox->setPosition(0, 0);
+        listBox->setSize(200, 100);
+        listBox->setItemHeight(20);
+        listBox->getRenderer()->setBorders(0);
+        listBox->getRenderer()->setPadding(0);
+        listBox->addItem("Item 0", "0");
+        listBox->addItem("Item 1", "1");
+        listBox->addItem("Item 2", "2");
+        listBox->setDataSource(dataSource);
+
+        unsigned int itemSelectedCount = 0;
+        listBox->connect("ItemSelected", [&](){ ++itemSelectedCount; });
+
+        REQUIRE(listBox->setSelectedItemByIndex(10));
+        REQUIRE(itemSelectedCount == 1);
+
+        // The items of the list box have no influence on the selected row
+        REQUIRE(listBox->removeItemByIndex(0));
+        REQUIRE(listBox->getItemCount() == 2);
+        REQUIRE(listBox->getSelectedItemIndex() == 10);
+        REQUIRE(listBox->getSelectedItem() == "Row 10");
+
+        REQUIRE(listBox->removeItemByIndex(1));
+        REQUIRE(listBox->getSelectedItemIndex() == 10);
+        REQUIRE(itemSelectedCount == 1);
+
+        // The rows of the data source can't be selected by name or id, which keeps the selection
+        REQUIRE(!listBox->setSelectedItem("Item 1"));
+        REQUIRE(!listBox->setSelectedItemById("1"));
+        REQUIRE(!listBox->setSelectedItem("Row 3"));
+        REQUIRE(listBox->getSelectedItemIndex() == 10);
+        REQUIRE(itemSelectedCount == 1);
+
+        // The item count is the amount of items that were added to the list box, not the amount of rows
+        REQUIRE(listBox->getItemCount() == 1);
+        REQUIRE(listBox->getShownItemCount() == 1000000);
+
+        // Adding items doesn't scroll the rows, even with auto-scrolling. Row 10 was scrolled into view at the bottom.
+        listBox->setAutoScroll(true);
+        REQUIRE(listBox->addItem("Item 3"));
+        REQUIRE(listBox->getItemCount() == 2);
+        listBox->leftMousePressed({10, 5});
+        REQUIRE(listBox->getSelectedItemIndex() == 6);
+
+        // Removing all items keeps the selection and the scrollbar of the rows
+        listBox->setSelectedItemByIndex(500000);
+        itemSelectedCount = 0;
+        listBox->removeAllItems();
+        REQUIRE(listBox->getItemCount() == 0);
+        REQUIRE(listBox->getSelectedItemIndex() == 500000);
+        REQUIRE(itemSelectedCount == 0);
+
+        listBox->leftMousePressed({10, 5});
+        REQUIRE(listBox->getSelectedItemIndex() == 499996);
+
+        listBox->setDataSource(nullptr);
+        REQUIRE(listBox->getShownItemCount() == 0);
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
         REQUIRE(listBox->getItemHeight() == 20);
+
+        listBox->addItem("Item 1");
+        listBox->addItem("Item 2");
+        listBox->addItem("Item 3");
+        REQUIRE(listBox->setItemHeightByIndex(1, 50));
+        REQUIRE(!listBox->setItemHeightByIndex(3, 50));
+        REQUIRE(listBox->getItemHeightByIndex(0) == 20);
+        REQUIRE(listBox->getItemHeightByIndex(1) == 50);
+        REQUIRE(listBox->getItemHeightByIndex(3) == 0);
+
+        // Items are found by the sum of the heights of the items above them
+        listBox->setPosition(0, 0);
+        listBox->setSize(200, 300);
+        listBox->getRenderer()->setBorders(0);
+        listBox->getRenderer()->setPadding(0);
+        listBox->leftMousePressed({10, 60});
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+        listBox->leftMousePressed({10, 75});
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+        listBox->setItemHeight(30);
+        REQUIRE(listBox->getItemHeightByIndex(1) == 30);
     }
 
     SECTION("MaximumItems")
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/WordWrapper.hpp>
+
+TEST_CASE("[WordWrapper]")
+{
+    const tgui::Font font{"resources/DejaVuSans.ttf"};
+
+    tgui::priv::WordWrapper wordWrapper;
+    wordWrapper.setFont(font, 20, false);
+    wordWrapper.setText("First paragraph that is long enough to be split\nshort\n\nLast paragraph that is long enough to be split");
+
+    const auto joinLines = [&]{
+        sf::String result;
+        const auto& lines = wordWrapper.getLines();
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            if (i > 0)
+                result += "\n";
+
+            result += wordWrapper.getText().substring(lines[i].begin, lines[i].end - lines[i].begin);
+        }
+        return result;
+    };
+
+    SECTION("Line breaks")
+    {
+        // The widths lie far enough from the width of each line that small differences in font rendering don't matter
+        wordWrapper.setMaximumWidth(0);
+        REQUIRE(joinLines() == "First paragraph that is long enough to be split\nshort\n\nLast paragraph that is long enough to be split");
+
+        wordWrapper.setMaximumWidth(166);
+        REQUIRE(joinLines() == "First paragraph \nthat is long \nenough to be \nsplit\nshort\n\n"
+                               "Last paragraph \nthat is long \nenough to be \nsplit");
+
+        wordWrapper.setMaximumWidth(248);
+        REQUIRE(joinLines() == "First paragraph that is \nlong enough to be split\nshort\n\nLast paragraph that is \nlong enough to be split");
+
+        wordWrapper.setMaximumWidth(300);
+        REQUIRE(joinLines() == "First paragraph that is long \nenough to be split\nshort\n\nLast paragraph that is long \nenough to be split");
+
+        // A word that doesn't fit on a line is split
+        wordWrapper.setText("Incomprehensibilities");
+        wordWrapper.setMaximumWidth(100);
+        const auto& lines = wordWrapper.getLines();
+        REQUIRE(lines.size() > 1);
+        REQUIRE(lines.front().begin == 0);
+        REQUIRE(lines.back().end == 21);
+    }
+
+    SECTION("Only affected paragraphs are wrapped again")
+    {
+        wordWrapper.setMaximumWidth(200);
+        wordWrapper.getLines();
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 4);
+
+        // Nothing changed
+        wordWrapper.getLines();
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 0);
+
+        // The short paragraphs fit on a single line for both widths
+        wordWrapper.setMaximumWidth(250);
+        wordWrapper.getLines();
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 2);
+
+        // Editing the second paragraph doesn't affect the others
+        wordWrapper.setText("First paragraph that is long enough to be split\nshorter\n\nLast paragraph that is long enough to be split");
+        REQUIRE(joinLines() == "First paragraph that is \nlong enough to be split\nshorter\n\nLast paragraph that is \nlong enough to be split");
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 1);
+
+        wordWrapper.setFont(font, 30, false);
+        wordWrapper.getLines();
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 4);
+
+        // Without a maximum width, the paragraphs that didn't change are also kept
+        wordWrapper.setMaximumWidth(0);
+        wordWrapper.getLines();
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 2);
+
+        wordWrapper.getLines();
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 0);
+
+        wordWrapper.setText("First paragraph that is long enough to be split\nshort\n\nLast paragraph that is long enough to be split");
+        wordWrapper.getLines();
+        REQUIRE(wordWrapper.getWrappedParagraphCount() == 1);
+    }
+}